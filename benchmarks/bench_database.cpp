@@ -0,0 +1,165 @@
+// Benchmarks for the library's hot paths: statement execution, element
+// creation (scalars, vectors, time series), label lookups, large-result
+// materialization and migration replay.
+
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <psr/psr.h>
+#include <string>
+
+namespace {
+
+namespace fs = std::filesystem;
+
+psr::Database make_db() {
+    psr::Database db(":memory:", psr::LogLevel::off);
+    db.execute("CREATE TABLE Plant (id INTEGER PRIMARY KEY AUTOINCREMENT, label TEXT UNIQUE NOT NULL, capacity REAL)");
+    db.execute("CREATE TABLE Plant_vector_costs (id INTEGER REFERENCES Plant(id), vector_index INTEGER NOT NULL, "
+               "cost REAL)");
+    db.execute("CREATE TABLE Plant_time_series_generation (id INTEGER REFERENCES Plant(id), date_time TEXT, "
+               "generation REAL)");
+    return db;
+}
+
+}  // anonymous namespace
+
+static void BM_ExecuteInsertSingle(benchmark::State& state) {
+    auto db = make_db();
+    int64_t i = 0;
+    for (auto _ : state) {
+        db.execute("INSERT INTO Plant (label, capacity) VALUES (?, ?)",
+                   {psr::Value{std::string("p") + std::to_string(i++)}, psr::Value{1.0}});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ExecuteInsertSingle);
+
+static void BM_ExecuteInsertBatched(benchmark::State& state) {
+    auto db = make_db();
+    int64_t i = 0;
+    for (auto _ : state) {
+        db.begin_transaction();
+        for (int64_t n = 0; n < state.range(0); ++n) {
+            db.execute("INSERT INTO Plant (label, capacity) VALUES (?, ?)",
+                       {psr::Value{std::string("p") + std::to_string(i++)}, psr::Value{1.0}});
+        }
+        db.commit();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecuteInsertBatched)->Arg(100)->Arg(1000);
+
+static void BM_CreateElementScalars(benchmark::State& state) {
+    auto db = make_db();
+    int64_t i = 0;
+    for (auto _ : state) {
+        db.create_element("Plant", {{"label", psr::Value{std::string("p") + std::to_string(i++)}},
+                                    {"capacity", psr::Value{100.0}}});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CreateElementScalars);
+
+static void BM_CreateElementVectors(benchmark::State& state) {
+    auto db = make_db();
+    std::vector<double> costs(static_cast<size_t>(state.range(0)), 1.5);
+    int64_t i = 0;
+    for (auto _ : state) {
+        db.create_element("Plant", {{"label", psr::Value{std::string("p") + std::to_string(i++)}},
+                                    {"cost", psr::Value{costs}}});
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CreateElementVectors)->Arg(100);
+
+static void BM_CreateElementTimeSeries(benchmark::State& state) {
+    auto db = make_db();
+    psr::TimeSeries series;
+    std::vector<psr::Value> dates, values;
+    for (int64_t n = 0; n < state.range(0); ++n) {
+        dates.emplace_back(std::string("2024-01-01 ") + std::to_string(n));
+        values.emplace_back(static_cast<double>(n));
+    }
+    series["date_time"] = dates;
+    series["generation"] = values;
+
+    int64_t i = 0;
+    for (auto _ : state) {
+        db.create_element("Plant", {{"label", psr::Value{std::string("p") + std::to_string(i++)}}},
+                          {{"generation", series}});
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CreateElementTimeSeries)->Arg(8760);
+
+static void BM_GetElementId(benchmark::State& state) {
+    auto db = make_db();
+    for (int i = 0; i < 1000; ++i) {
+        db.create_element("Plant", {{"label", psr::Value{std::string("p") + std::to_string(i)}}});
+    }
+    if (state.range(0)) {
+        db.prefetch_labels("Plant");
+    }
+
+    int64_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(db.get_element_id("Plant", "p" + std::to_string(i++ % 1000)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetElementId)->Arg(0)->Arg(1);  // 0 = point queries, 1 = prefetched
+
+static void BM_ExecuteLargeResult(benchmark::State& state) {
+    auto db = make_db();
+    db.begin_transaction();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        db.execute("INSERT INTO Plant (label, capacity) VALUES (?, ?)",
+                   {psr::Value{std::string("p") + std::to_string(i)}, psr::Value{i * 0.5}});
+    }
+    db.commit();
+
+    for (auto _ : state) {
+        auto result = db.execute("SELECT id, label, capacity FROM Plant");
+        benchmark::DoNotOptimize(result.row_count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecuteLargeResult)->Arg(100000);
+
+static void BM_ExecuteColumnarLargeResult(benchmark::State& state) {
+    auto db = make_db();
+    db.begin_transaction();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        db.execute("INSERT INTO Plant (label, capacity) VALUES (?, ?)",
+                   {psr::Value{std::string("p") + std::to_string(i)}, psr::Value{i * 0.5}});
+    }
+    db.commit();
+
+    for (auto _ : state) {
+        auto result = db.execute_columnar("SELECT id, label, capacity FROM Plant");
+        benchmark::DoNotOptimize(result.row_count());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExecuteColumnarLargeResult)->Arg(100000);
+
+static void BM_MigrateUp(benchmark::State& state) {
+    // Replay a numbered migration chain into a fresh database each iteration
+    fs::path schema_dir = fs::temp_directory_path() / "psr_bench_schema";
+    fs::remove_all(schema_dir);
+    for (int version = 1; version <= 10; ++version) {
+        fs::create_directories(schema_dir / std::to_string(version));
+        std::ofstream out(schema_dir / std::to_string(version) / "up.sql");
+        out << "CREATE TABLE t" << version << " (id INTEGER PRIMARY KEY, v REAL);";
+    }
+
+    for (auto _ : state) {
+        auto db = psr::Database::from_schema(":memory:", schema_dir.string(), psr::LogLevel::off);
+        benchmark::DoNotOptimize(db.current_version());
+    }
+    state.SetItemsProcessed(state.iterations() * 10);
+
+    fs::remove_all(schema_dir);
+}
+BENCHMARK(BM_MigrateUp);
@@ -49,6 +49,17 @@ if(PSR_BUILD_TESTS)
     FetchContent_MakeAvailable(googletest)
 endif()
 
+# Google Benchmark for the benchmark suite
+if(PSR_BUILD_BENCHMARKS)
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    FetchContent_Declare(googlebenchmark
+        GIT_REPOSITORY https://github.com/google/benchmark.git
+        GIT_TAG v1.9.1
+    )
+    FetchContent_MakeAvailable(googlebenchmark)
+endif()
+
 # pybind11 for Python bindings
 if(PSR_BUILD_PYTHON_BINDING)
     find_package(Python COMPONENTS Interpreter Development REQUIRED)
@@ -0,0 +1,59 @@
+#ifndef PSR_DATABASE_BLOB_STREAM_H
+#define PSR_DATABASE_BLOB_STREAM_H
+
+#include "export.h"
+
+#include <cstdint>
+#include <memory>
+
+struct sqlite3;
+struct sqlite3_blob;
+
+namespace psr {
+
+// Incremental blob I/O over sqlite3_blob_open: read and write slices of a
+// stored BLOB at arbitrary offsets without materializing the whole cell.
+// Returned by Database::open_blob().
+//
+// Incremental writes cannot change a blob's size: insert a placeholder of
+// the final size first (e.g. `INSERT ... VALUES (zeroblob(?))`), then
+// stream the content in chunks. The stream is invalidated if its row is
+// modified; operations then fail with an error. A BlobStream must not
+// outlive the Database it came from.
+class PSR_API BlobStream {
+public:
+    ~BlobStream();
+
+    // Non-copyable
+    BlobStream(const BlobStream&) = delete;
+    BlobStream& operator=(const BlobStream&) = delete;
+
+    // Movable
+    BlobStream(BlobStream&& other) noexcept;
+    BlobStream& operator=(BlobStream&& other) noexcept;
+
+    // Total size of the underlying blob in bytes
+    size_t size() const;
+
+    // Reads up to `length` bytes starting at `offset` into `buffer`,
+    // clamped to the blob's end. Returns the number of bytes read.
+    size_t read(size_t offset, void* buffer, size_t length) const;
+
+    // Writes `length` bytes at `offset`; throws if the range exceeds the
+    // blob's size or the stream was opened read-only
+    void write(size_t offset, const void* data, size_t length);
+
+    void close();
+
+private:
+    friend class Database;
+
+    BlobStream(sqlite3* db, sqlite3_blob* blob);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_BLOB_STREAM_H
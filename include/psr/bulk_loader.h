@@ -0,0 +1,83 @@
+#ifndef PSR_DATABASE_BULK_LOADER_H
+#define PSR_DATABASE_BULK_LOADER_H
+
+#include "database.h"
+#include "export.h"
+#include "result.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace psr {
+
+// Parallel bulk ingestion of vector and time series chunks. Callers
+// enqueue per-table columnar chunks; a pool of writer connections (WAL
+// mode) drains them, each table owned by exactly one worker so a table's
+// chunks apply in enqueue order without cross-worker interleaving.
+// Workers group queued chunks into transactions; SQLite still serializes
+// concurrent commits on the file's write lock, which the connections'
+// busy timeout absorbs.
+//
+// wait() is the final barrier: it blocks until every queued chunk has
+// committed, rethrows the first worker error, verifies the workers agree
+// on PRAGMA user_version and runs PRAGMA foreign_key_check, throwing on
+// violations.
+class PSR_API BulkLoader {
+public:
+    BulkLoader(const std::string& path, size_t workers, LogLevel console_level = LogLevel::info);
+    ~BulkLoader();
+
+    // Non-copyable, non-movable (workers hold references into the loader)
+    BulkLoader(const BulkLoader&) = delete;
+    BulkLoader& operator=(const BulkLoader&) = delete;
+
+    // Enqueue one time series chunk for an element (columns as in
+    // Database::create_element's time_series argument)
+    void enqueue_time_series(const std::string& collection, const std::string& group, int64_t element_id,
+                             TimeSeries data);
+
+    // Enqueue one vector/set chunk for an element (fields as in
+    // create_element's vector fields)
+    void enqueue_vectors(const std::string& collection, int64_t element_id,
+                         std::vector<std::pair<std::string, Value>> fields);
+
+    // Barrier: drains every queue, reconciles user_version and FK checks
+    void wait();
+
+private:
+    struct Chunk {
+        bool is_time_series = false;
+        std::string collection;
+        std::string group;  // time series only
+        int64_t element_id = 0;
+        TimeSeries series;
+        std::vector<std::pair<std::string, Value>> fields;
+    };
+
+    struct Worker {
+        std::unique_ptr<Database> db;
+        std::deque<Chunk> queue;
+        std::thread thread;
+        bool busy = false;
+    };
+
+    void worker_loop(Worker& worker);
+    size_t worker_for_table(const std::string& collection, const std::string& group) const;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable drained_cv_;
+    bool stop_ = false;
+    std::string first_error_;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_BULK_LOADER_H
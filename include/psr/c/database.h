@@ -40,6 +40,13 @@ typedef enum {
     PSR_LOG_OFF = 4,
 } psr_log_level_t;
 
+// Connection performance profiles (see psr::Durability)
+typedef enum {
+    PSR_DURABILITY_FAST = 0,
+    PSR_DURABILITY_BALANCED = 1,
+    PSR_DURABILITY_SAFE = 2,
+} psr_durability_t;
+
 // Opaque handle types
 typedef struct psr_database psr_database_t;
 typedef struct psr_result psr_result_t;
@@ -50,11 +57,25 @@ typedef struct psr_time_series psr_time_series_t;
 PSR_C_API psr_database_t* psr_database_open(const char* path, psr_log_level_t console_level, psr_error_t* error);
 PSR_C_API psr_database_t* psr_database_from_schema(const char* db_path, const char* schema_path,
                                                    psr_log_level_t console_level, psr_error_t* error);
+
+// Variants taking an explicit connection profile; the plain open functions
+// use PSR_DURABILITY_BALANCED
+PSR_C_API psr_database_t* psr_database_open_with_profile(const char* path, psr_log_level_t console_level,
+                                                         psr_durability_t durability, psr_error_t* error);
+PSR_C_API psr_database_t* psr_database_from_schema_with_profile(const char* db_path, const char* schema_path,
+                                                                psr_log_level_t console_level,
+                                                                psr_durability_t durability, psr_error_t* error);
 PSR_C_API void psr_database_close(psr_database_t* db);
 PSR_C_API int psr_database_is_open(psr_database_t* db);
 PSR_C_API psr_result_t* psr_database_execute(psr_database_t* db, const char* sql, psr_error_t* error);
 PSR_C_API int64_t psr_database_last_insert_rowid(psr_database_t* db);
 PSR_C_API int psr_database_changes(psr_database_t* db);
+// Async write pipeline: submit enqueues a statement for the background
+// writer thread; flush blocks until everything queued has committed and
+// reports the first writer error, if any
+PSR_C_API psr_error_t psr_database_submit(psr_database_t* db, const char* sql);
+PSR_C_API psr_error_t psr_database_flush(psr_database_t* db);
+
 PSR_C_API psr_error_t psr_database_begin_transaction(psr_database_t* db);
 PSR_C_API psr_error_t psr_database_commit(psr_database_t* db);
 PSR_C_API psr_error_t psr_database_rollback(psr_database_t* db);
@@ -97,10 +118,88 @@ PSR_C_API psr_error_t psr_element_add_time_series(psr_element_t* elem, const cha
 PSR_C_API int64_t psr_database_create_element(psr_database_t* db, const char* table, psr_element_t* elem,
                                               psr_error_t* error);
 
+// Bulk element creation: inserts count elements in a single transaction
+// and writes the assigned rowids into the caller-allocated rowids array
+// (count entries). On error nothing is inserted.
+PSR_C_API psr_error_t psr_database_create_elements(psr_database_t* db, const char* table,
+                                                   psr_element_t* const* elements, size_t count, int64_t* rowids);
+
+// Element batch builder: column definitions are given once, then rows are
+// appended with typed per-column calls and finished with
+// psr_batch_row_finish (columns left unset in a row are omitted, so table
+// defaults apply). psr_database_batch_flush inserts every finished row
+// through the bulk create_elements path in one transaction, optionally
+// writing rowids into a caller array of at least the row count, and
+// resets the batch so it can be refilled for the next chunk.
+typedef struct psr_element_batch psr_element_batch_t;
+
+PSR_C_API psr_element_batch_t* psr_element_batch_create(const char* table, const char** columns, size_t column_count);
+PSR_C_API void psr_element_batch_free(psr_element_batch_t* batch);
+PSR_C_API size_t psr_element_batch_row_count(psr_element_batch_t* batch);
+
+PSR_C_API psr_error_t psr_batch_append_null(psr_element_batch_t* batch, size_t column);
+PSR_C_API psr_error_t psr_batch_append_int64(psr_element_batch_t* batch, size_t column, int64_t value);
+PSR_C_API psr_error_t psr_batch_append_double(psr_element_batch_t* batch, size_t column, double value);
+PSR_C_API psr_error_t psr_batch_append_text(psr_element_batch_t* batch, size_t column, const char* value);
+PSR_C_API psr_error_t psr_batch_append_int64_array(psr_element_batch_t* batch, size_t column, const int64_t* values,
+                                                   size_t count);
+PSR_C_API psr_error_t psr_batch_append_double_array(psr_element_batch_t* batch, size_t column, const double* values,
+                                                    size_t count);
+PSR_C_API psr_error_t psr_batch_row_finish(psr_element_batch_t* batch);
+PSR_C_API psr_error_t psr_database_batch_flush(psr_database_t* db, psr_element_batch_t* batch, int64_t* rowids);
+
 // Element lookup
 PSR_C_API int64_t psr_database_get_element_id(psr_database_t* db, const char* collection, const char* label,
                                               psr_error_t* error);
 
+// Change tracking: the callback fires inside the write path for every row
+// modification once enabled (op: 0=insert, 1=update, 2=delete). Pass a
+// NULL callback to disable.
+typedef void (*psr_change_callback_t)(void* context, const char* table, int64_t rowid, int op);
+PSR_C_API psr_error_t psr_database_set_change_callback(psr_database_t* db, psr_change_callback_t callback,
+                                                       void* context);
+
+// Online backup to a file (overwritten); reads and writes continue on the
+// source while the copy proceeds
+PSR_C_API psr_error_t psr_database_backup(psr_database_t* db, const char* path);
+
+// Incremental blob I/O (see psr::BlobStream). Writes cannot grow a blob;
+// insert a zeroblob placeholder of the final size first.
+typedef struct psr_blob_stream psr_blob_stream_t;
+
+PSR_C_API psr_blob_stream_t* psr_database_open_blob(psr_database_t* db, const char* table, const char* column,
+                                                    int64_t rowid, int writable, psr_error_t* error);
+PSR_C_API void psr_blob_stream_free(psr_blob_stream_t* stream);
+PSR_C_API size_t psr_blob_stream_size(psr_blob_stream_t* stream);
+// Reads up to `length` bytes at `offset`, clamped to the blob's end;
+// returns the number of bytes read (0 on error or past-the-end offsets)
+PSR_C_API size_t psr_blob_stream_read(psr_blob_stream_t* stream, size_t offset, uint8_t* buffer, size_t length);
+PSR_C_API psr_error_t psr_blob_stream_write(psr_blob_stream_t* stream, size_t offset, const uint8_t* data,
+                                            size_t length);
+
+// Hot-path instrumentation (see psr::DatabaseStats). histogram[i] counts
+// operations whose latency was < 2^i microseconds.
+typedef struct {
+    uint64_t count;
+    uint64_t total_us;
+    uint64_t max_us;
+    uint64_t histogram[20];
+} psr_operation_stats_t;
+
+typedef struct {
+    psr_operation_stats_t prepare;
+    psr_operation_stats_t bind;
+    psr_operation_stats_t step;
+    psr_operation_stats_t commit;
+    psr_operation_stats_t migration;
+    psr_operation_stats_t introspection;
+    uint64_t query_cache_hits;
+    uint64_t query_cache_misses;
+} psr_database_stats_t;
+
+PSR_C_API psr_error_t psr_database_set_stats_enabled(psr_database_t* db, int enabled);
+PSR_C_API psr_error_t psr_database_get_stats(psr_database_t* db, psr_database_stats_t* out);
+
 // Utility functions
 PSR_C_API const char* psr_error_string(psr_error_t error);
 PSR_C_API const char* psr_version(void);
@@ -28,6 +28,18 @@ PSR_C_API psr_error_t psr_result_get_double(psr_result_t* result, size_t row, si
 PSR_C_API const char* psr_result_get_string(psr_result_t* result, size_t row, size_t col);
 PSR_C_API const uint8_t* psr_result_get_blob(psr_result_t* result, size_t row, size_t col, size_t* size);
 
+// Zero-copy cell references: pointers into the result's own storage, valid
+// until psr_result_free. Unlike psr_result_get_string, text refs report
+// their length, so embedded NUL bytes survive the FFI boundary.
+PSR_C_API const char* psr_result_get_text_ref(psr_result_t* result, size_t row, size_t col, size_t* size);
+PSR_C_API const uint8_t* psr_result_get_blob_ref(psr_result_t* result, size_t row, size_t col, size_t* size);
+
+// Bulk column extraction into a caller-allocated array of capacity n.
+// Returns the number of rows written (min of n and the row count); null or
+// non-numeric cells are written as 0.
+PSR_C_API size_t psr_result_copy_column_doubles(psr_result_t* result, size_t col, double* out, size_t n);
+PSR_C_API size_t psr_result_copy_column_ints(psr_result_t* result, size_t col, int64_t* out, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,88 @@
+#ifndef PSR_DATABASE_COLUMNAR_RESULT_H
+#define PSR_DATABASE_COLUMNAR_RESULT_H
+
+#include "export.h"
+#include "result.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace psr {
+
+// Column-oriented query result for analytical scans, produced by
+// Database::execute_columnar(). Each column is a contiguous typed array
+// (int64/double, or an arena of text/blob bytes with per-row offsets) plus
+// a null bitmap, so scanning one column of a large result touches dense
+// memory instead of per-cell variants.
+//
+// A column's type is fixed by its first non-null value; later cells are
+// coerced to it with SQLite's usual conversions.
+class PSR_API ColumnarResult {
+public:
+    enum class ColumnType { null, integer, real, text, blob };
+
+    ColumnarResult() = default;
+
+    bool empty() const { return row_count_ == 0; }
+    size_t row_count() const { return row_count_; }
+    size_t column_count() const { return columns_.size(); }
+
+    const std::vector<std::string>& columns() const { return names_; }
+    ColumnType column_type(size_t col) const;
+
+    bool is_null(size_t col, size_t row) const;
+
+    // Dense typed storage (throws if the column holds a different type).
+    // Null cells occupy a slot with value 0 / 0.0; check is_null.
+    const std::vector<int64_t>& int_column(size_t col) const;
+    const std::vector<double>& double_column(size_t col) const;
+
+    // Arena-backed text/blob access (views valid for the result's lifetime;
+    // empty view for null cells)
+    std::string_view text(size_t col, size_t row) const;
+    BlobView blob(size_t col, size_t row) const;
+
+    // Vectorized bulk scans over a REAL column's dense buffer (SIMD
+    // kernels with runtime dispatch; null slots participate as 0.0 - check
+    // null_count when that matters)
+    double column_sum(size_t col) const;
+    std::pair<double, double> column_min_max(size_t col) const;
+    ptrdiff_t find_first_above(size_t col, double threshold) const;  // row index or -1
+
+    // Set bits in the column's null bitmap (population count)
+    size_t null_count(size_t col) const;
+
+private:
+    friend class Database;
+
+    struct Column {
+        ColumnType type = ColumnType::null;
+        std::vector<int64_t> ints;
+        std::vector<double> reals;
+        std::string arena;             // concatenated text/blob bytes
+        std::vector<size_t> offsets;   // row_count + 1 entries once typed
+        std::vector<uint8_t> nulls;    // 1 bit per row
+    };
+
+    const Column& checked_column(size_t col) const;
+
+    // Fill helpers used by execute_columnar (rows must be appended in
+    // lockstep across all columns)
+    void set_columns(std::vector<std::string> names);
+    void decide_type(size_t col, ColumnType type);
+    void append_int(size_t col, int64_t value);
+    void append_double(size_t col, double value);
+    void append_bytes(size_t col, const char* data, size_t size);
+    void append_null(size_t col);
+    void finish_row() { ++row_count_; }
+
+    std::vector<std::string> names_;
+    std::vector<Column> columns_;
+    size_t row_count_ = 0;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_COLUMNAR_RESULT_H
@@ -0,0 +1,98 @@
+#ifndef PSR_DATABASE_CURSOR_H
+#define PSR_DATABASE_CURSOR_H
+
+#include "export.h"
+#include "result.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct sqlite3;
+struct sqlite3_stmt;
+
+namespace psr {
+
+// Streaming cursor over a query result: one sqlite3_step per advance,
+// holding only the current row in memory. Returned by Database::query()
+// as an alternative to the fully-materializing Database::execute().
+//
+// Text and blob accessors return views into SQLite's column buffers;
+// they are invalidated by the next step() and by destroying the cursor.
+// A Cursor must not outlive the Database it came from.
+class PSR_API Cursor {
+public:
+    ~Cursor();
+
+    // Non-copyable
+    Cursor(const Cursor&) = delete;
+    Cursor& operator=(const Cursor&) = delete;
+
+    // Movable
+    Cursor(Cursor&& other) noexcept;
+    Cursor& operator=(Cursor&& other) noexcept;
+
+    // Advance to the next row. Returns false when the result is exhausted.
+    bool step();
+
+    // True once step() has returned false
+    bool done() const;
+
+    size_t column_count() const;
+    const std::vector<std::string>& columns() const;
+
+    // Current-row accessors (valid after a successful step())
+    bool is_null(size_t index) const;
+    std::optional<int64_t> get_int(size_t index) const;
+    std::optional<double> get_double(size_t index) const;
+    std::optional<std::string_view> get_text(size_t index) const;
+    std::optional<BlobView> get_blob(size_t index) const;
+
+    // Typed decoding: advances the cursor and fills the struct (defined in
+    // row_decoder.h; requires a psr::row_binding<S> specialization)
+    template <typename S>
+    bool next(S& out);
+
+    // Iterator support: `for (const auto& row : cursor)` yields the cursor
+    // itself positioned on each row
+    class iterator {
+    public:
+        explicit iterator(Cursor* cursor) : cursor_(cursor) {}
+
+        const Cursor& operator*() const { return *cursor_; }
+        iterator& operator++() {
+            if (!cursor_->step()) {
+                cursor_ = nullptr;
+            }
+            return *this;
+        }
+        bool operator!=(const iterator& other) const { return cursor_ != other.cursor_; }
+
+    private:
+        Cursor* cursor_;
+    };
+
+    iterator begin() {
+        return step() ? iterator(this) : iterator(nullptr);
+    }
+    iterator end() { return iterator(nullptr); }
+
+private:
+    friend class Database;
+
+    // Takes ownership of the prepared statement. The connection mutex is
+    // held while stepping so update hooks fired by write statements see
+    // the same lock order as execute() (connection lock inside db_mutex).
+    Cursor(sqlite3* db, sqlite3_stmt* stmt, std::recursive_mutex* db_mutex);
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_CURSOR_H
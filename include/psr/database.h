@@ -1,10 +1,15 @@
 #ifndef PSR_DATABASE_DATABASE_H
 #define PSR_DATABASE_DATABASE_H
 
+#include "blob_stream.h"
+#include "columnar_result.h"
+#include "cursor.h"
 #include "export.h"
 #include "result.h"
 
+#include <array>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -15,16 +20,73 @@ struct sqlite3;
 
 namespace psr {
 
+class Transaction;
+
 enum class LogLevel { debug, info, warn, error, off };
 
+// Connection performance profile applied at construction. Each preset
+// configures journal mode, synchronous level, cache size, mmap size,
+// temp store and busy timeout as a coherent set:
+//   fast     - WAL, synchronous=OFF, large cache/mmap; fastest, a crash can
+//              lose the most recent transactions (not the database)
+//   balanced - WAL, synchronous=NORMAL; durable except on power loss
+//   safe     - rollback journal, synchronous=FULL; SQLite's classic defaults
+enum class Durability { fast, balanced, safe };
+
+// Aggregate operations for aggregate_vector
+enum class AggregateOp { sum, min, max, avg, count };
+
+// One recorded row modification (see Database::set_change_tracking)
+struct Change {
+    enum class Op { insert, update, remove };
+    std::string table;
+    int64_t rowid = 0;
+    Op op = Op::insert;
+};
+
+// Per-operation timing statistics (see Database::stats). histogram[i]
+// counts operations whose latency was < 2^i microseconds.
+struct DatabaseStats {
+    struct Operation {
+        uint64_t count = 0;
+        uint64_t total_us = 0;
+        uint64_t max_us = 0;
+        std::array<uint64_t, 20> histogram{};
+    };
+
+    // Query result cache counters (see Database::set_query_cache)
+    uint64_t query_cache_hits = 0;
+    uint64_t query_cache_misses = 0;
+
+    Operation prepare;        // sqlite3_prepare_v2 on statement cache misses
+    Operation bind;           // parameter binding
+    Operation step;           // statement step loops
+    Operation commit;         // transaction commits
+    Operation migration;      // individual migrations in migrate_up
+    Operation introspection;  // schema metadata cache fills
+};
+
 class PSR_API Database {
 public:
-    explicit Database(const std::string& path, LogLevel console_level = LogLevel::info);
+    // Prepared statement cache statistics
+    struct StatementCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    explicit Database(const std::string& path, LogLevel console_level = LogLevel::info,
+                      Durability durability = Durability::balanced);
     ~Database();
 
     // Factory method for schema-based initialization
     static Database from_schema(const std::string& database_path, const std::string& schema_path,
-                                LogLevel console_level = LogLevel::info);
+                                LogLevel console_level = LogLevel::info,
+                                Durability durability = Durability::balanced);
+
+    // Opens an existing database read-only (writes fail with an error).
+    // Used by DatabasePool for its reader connections.
+    static Database open_read_only(const std::string& path, LogLevel console_level = LogLevel::info,
+                                   Durability durability = Durability::balanced);
 
     // Non-copyable
     Database(const Database&) = delete;
@@ -40,6 +102,16 @@ public:
     Result execute(const std::string& sql);
     Result execute(const std::string& sql, const std::vector<Value>& params);
 
+    // Streaming alternative to execute(): rows are fetched one at a time as
+    // the cursor advances, so only the current row is held in memory
+    Cursor query(const std::string& sql);
+    Cursor query(const std::string& sql, const std::vector<Value>& params);
+
+    // Column-oriented alternative to execute(): fetches directly into
+    // contiguous per-column typed arrays (see ColumnarResult)
+    ColumnarResult execute_columnar(const std::string& sql);
+    ColumnarResult execute_columnar(const std::string& sql, const std::vector<Value>& params);
+
     int64_t last_insert_rowid() const;
     int changes() const;
 
@@ -47,15 +119,75 @@ public:
     void commit();
     void rollback();
 
+    // Asynchronous write pipeline: submit() enqueues a statement for a
+    // background writer thread that drains the queue in grouped
+    // transactions, so callers never wait on fsync. submit() blocks only
+    // when the queue exceeds the byte budget (backpressure). flush() waits
+    // until every queued write has committed and rethrows the first error
+    // the writer hit, if any. Neither may be called inside a transaction:
+    // the writer defers to user transactions, so the queue cannot drain.
+    void submit(const std::string& sql);
+    void submit(const std::string& sql, const std::vector<Value>& params);
+    void flush();
+    void set_async_write_budget(size_t bytes);
+
     const std::string& path() const;
     std::string error_message() const;
 
-    // Migration methods
+    // Prepared statement cache
+    StatementCacheStats statement_cache_stats() const;
+    void clear_statement_cache();
+
+    // Hot-path instrumentation: disabled by default (a single relaxed
+    // atomic load per operation), recording per-operation latency
+    // histograms when enabled
+    void set_stats_enabled(bool enabled);
+    bool stats_enabled() const;
+    DatabaseStats stats() const;
+    void reset_stats();
+
+    // Opt-in query result cache: read-only statements are cached keyed by
+    // (SQL, params), bounded by a byte budget with LRU eviction, and
+    // invalidated per table - each statement's read set is captured at
+    // prepare time, and any write to a read table (through this
+    // connection) drops the entries that depend on it, so cached reads
+    // always observe this connection's writes. Hit/miss counts appear in
+    // stats() as query_cache_hits/query_cache_misses.
+    void set_query_cache(bool enabled, size_t byte_budget = 8 * 1024 * 1024);
+
+    // Query plan diagnostics: when enabled, each SQL shape is analysed with
+    // EXPLAIN QUERY PLAN on its first preparation (through the statement
+    // cache). Shapes that full-scan a table while filtering on a column are
+    // collected for the index advisor.
+    struct IndexAdvice {
+        std::string table;     // table being scanned
+        std::string column;    // filtered column without index support
+        std::string sql;       // statement that triggered the scan
+        uint64_t occurrences;  // executions of the shape since diagnosis
+    };
+    void set_diagnostics_enabled(bool enabled);
+    std::vector<IndexAdvice> index_advisor_report() const;
+
+    // Migration methods. schema_path may be a directory of numbered
+    // migrations or a packed bundle file (see pack_migrations).
     int64_t current_version();
     void set_version(int64_t version);
     void migrate_up();
     const std::string& schema_path() const;
 
+    // Packs a schema directory's numbered migrations into a single bundle
+    // file. from_schema()/migrate_up() consume bundles without filesystem
+    // traversal and apply all pending migrations in one transaction (one
+    // fsync) instead of one commit per migration.
+    static void pack_migrations(const std::string& schema_path, const std::string& bundle_path);
+
+    // Cold-start fast path: clones a pre-migrated template database file
+    // into database_path (when it is missing or empty) and opens it,
+    // skipping migration replay entirely.
+    static Database from_template(const std::string& database_path, const std::string& template_path,
+                                  LogLevel console_level = LogLevel::info,
+                                  Durability durability = Durability::balanced);
+
     // Element creation (supports scalars, vectors, and time series)
     int64_t create_element(const std::string& table, const std::vector<std::pair<std::string, Value>>& fields);
 
@@ -63,14 +195,94 @@ public:
     int64_t create_element(const std::string& table, const std::vector<std::pair<std::string, Value>>& fields,
                            const std::map<std::string, TimeSeries>& time_series);
 
+    // Bulk element creation: prefetches foreign key label maps, runs all
+    // inserts in one transaction (rolled back as a unit on failure) and
+    // returns the assigned rowids in element order. time_series, when
+    // non-empty, must hold one entry per element.
+    std::vector<int64_t> create_elements(const std::string& table,
+                                         const std::vector<std::vector<std::pair<std::string, Value>>>& elements);
+    std::vector<int64_t> create_elements(const std::string& table,
+                                         const std::vector<std::vector<std::pair<std::string, Value>>>& elements,
+                                         const std::vector<std::map<std::string, TimeSeries>>& time_series);
+
+    // Cross-database attach: makes another SQLite file visible under an
+    // alias for server-side queries (main.t joined with alias.t)
+    void attach(const std::string& path, const std::string& alias);
+    void detach(const std::string& alias);
+
+    // Case merge: copies every table of the attached database (or only
+    // `tables`, when non-empty) into main with INSERT INTO main.t SELECT *
+    // FROM alias.t, ordered so foreign key parents load before children,
+    // all inside one transaction. Data never crosses the API boundary.
+    void merge_from(const std::string& alias, const std::vector<std::string>& tables = {});
+
+    // Online backup: copies the whole database to path using SQLite's
+    // backup API, proceeding in steps of pages_per_step with sleep_ms
+    // between them so readers and writers continue meanwhile. The optional
+    // progress callback receives (remaining, total) page counts after each
+    // step. The target file is overwritten.
+    void backup_to(const std::string& path, int pages_per_step = 256, int sleep_ms = 10,
+                   const std::function<void(int remaining, int total)>& progress = {});
+
+    // In-memory snapshot: a :memory: clone of the current database state,
+    // for read-only worker fan-out without touching the source file
+    Database snapshot(LogLevel console_level = LogLevel::off) const;
+
+    // Opens a stored BLOB for incremental (chunked) reads and writes at an
+    // offset; see BlobStream for lifetime and sizing rules
+    BlobStream open_blob(const std::string& table, const std::string& column, int64_t rowid, bool writable = false);
+
+    // Aggregate pushdown over a vector/set satellite column: runs the
+    // GROUP BY inside SQLite and returns (element id, aggregate) pairs in
+    // id order, instead of materializing every row to aggregate in the
+    // application. With group_by_element false, a single pair {0, value}
+    // aggregates the whole column.
+    std::vector<std::pair<int64_t, double>> aggregate_vector(const std::string& collection,
+                                                             const std::string& column, AggregateOp op,
+                                                             bool group_by_element = true);
+
+    // Native time series read path: returns the group's columns for one
+    // element as the columnar TimeSeries type, in insertion (rowid) order,
+    // using a cached prepared statement and typed column extraction. The
+    // range overload reads `limit` rows starting at `offset` (0-based).
+    TimeSeries read_time_series(const std::string& collection, const std::string& group, int64_t element_id);
+    TimeSeries read_time_series(const std::string& collection, const std::string& group, int64_t element_id,
+                                size_t offset, size_t limit);
+
     // Lookup element ID by label
     int64_t get_element_id(const std::string& collection, const std::string& label) const;
 
+    // Change tracking: when enabled, every row modification on this
+    // connection is recorded as a (table, rowid, op) tuple in a bounded
+    // ring buffer (oldest entries dropped when full), drained with
+    // poll_changes(). An optional callback fires inside the write path for
+    // event-driven invalidation; an optional table filter restricts which
+    // tables are recorded (empty = all).
+    void set_change_tracking(bool enabled, size_t capacity = 4096);
+    void set_change_filter(std::vector<std::string> tables);
+    void set_change_callback(std::function<void(const Change&)> callback);
+    std::vector<Change> poll_changes();
+
+    // Opt-in label cache: bulk-loads the collection's label->id map in one
+    // scan so subsequent get_element_id/relation lookups become hash lookups.
+    // The cached map is dropped automatically when the collection is written
+    // (write detection relies on sqlite3_update_hook, so WITHOUT ROWID
+    // collections must not be prefetched).
+    void prefetch_labels(const std::string& collection);
+
 private:
+    friend class Transaction;
+    friend class BulkLoader;
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 
-    // Schema introspection
+    Database(const std::string& path, LogLevel console_level, Durability durability, bool read_only);
+
+    // Schema introspection (backed by a lazily-built per-connection cache,
+    // invalidated on DDL execution and migrations)
+    std::vector<std::string> get_tables_with_prefix(const std::string& prefix) const;
+    void ensure_table_schema(const std::string& table) const;
     std::vector<std::string> get_vector_tables(const std::string& collection) const;
     std::vector<std::string> get_set_tables(const std::string& collection) const;
     std::vector<std::string> get_time_series_tables(const std::string& collection) const;
@@ -90,6 +302,13 @@ private:
     void insert_time_series(const std::string& collection, int64_t element_id,
                             const std::map<std::string, TimeSeries>& time_series);
 
+    // Batched multi-row insertion: prepares the statement once and binds/steps
+    // each row, wrapped in a single transaction unless one is already active
+    void execute_batch(const std::string& sql, const std::vector<std::vector<Value>>& rows);
+
+    // Runs a (possibly multi-statement) SQL script; used by migrations
+    void execute_script(const std::string& sql);
+
     // Relation resolution
     Value resolve_relation(const std::string& table, const std::string& column, const Value& value);
 
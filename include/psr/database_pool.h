@@ -0,0 +1,73 @@
+#ifndef PSR_DATABASE_DATABASE_POOL_H
+#define PSR_DATABASE_DATABASE_POOL_H
+
+#include "database.h"
+#include "export.h"
+#include "result.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace psr {
+
+// Pool of read-only connections to one database file. In WAL mode SQLite
+// supports unlimited concurrent readers, so SELECT-heavy workloads can fan
+// out across the pool instead of serializing behind a single connection.
+// Each connection warms its own statement/schema caches.
+class PSR_API DatabasePool {
+public:
+    // Opens `size` read-only connections to an existing database
+    DatabasePool(const std::string& path, size_t size, LogLevel console_level = LogLevel::info,
+                 Durability durability = Durability::balanced);
+    ~DatabasePool();
+
+    // Non-copyable, non-movable (leases hold pointers into the pool)
+    DatabasePool(const DatabasePool&) = delete;
+    DatabasePool& operator=(const DatabasePool&) = delete;
+
+    size_t size() const;
+
+    // RAII lease on a pooled connection; returns it on destruction
+    class PSR_API Lease {
+    public:
+        ~Lease();
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+
+        Database& operator*() { return *db_; }
+        Database* operator->() { return db_; }
+
+    private:
+        friend class DatabasePool;
+        Lease(DatabasePool* pool, Database* db) : pool_(pool), db_(db) {}
+
+        DatabasePool* pool_;
+        Database* db_;
+    };
+
+    // Blocks until a connection is free
+    Lease acquire();
+
+    // Runs the queries across the pool with one worker per connection (at
+    // most queries.size()), returning results in query order. The first
+    // worker error is rethrown after all workers finish.
+    std::vector<Result> parallel_query(const std::vector<std::string>& queries);
+
+private:
+    void release(Database* db);
+
+    std::vector<std::unique_ptr<Database>> connections_;
+    std::vector<Database*> available_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_DATABASE_POOL_H
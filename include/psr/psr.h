@@ -1,8 +1,16 @@
 #ifndef PSR_H
 #define PSR_H
 
+#include "blob_stream.h"
+#include "bulk_loader.h"
+#include "columnar_result.h"
+#include "cursor.h"
 #include "database.h"
+#include "database_pool.h"
 #include "export.h"
 #include "result.h"
+#include "row_decoder.h"
+#include "simd_kernels.h"
+#include "transaction.h"
 
 #endif  // PSR_H
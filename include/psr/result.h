@@ -8,11 +8,20 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
 namespace psr {
 
+// Zero-copy view of a blob value. Views returned by Row are valid for the
+// lifetime of the backing Result; views returned by Cursor are valid until
+// the next step().
+struct BlobView {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
 // Scalar value types
 using Value = std::variant<std::nullptr_t, int64_t, double, std::string,
                            std::vector<uint8_t>,     // blob
@@ -38,8 +47,30 @@ public:
     std::optional<std::vector<uint8_t>> get_blob(size_t index) const;
     bool is_null(size_t index) const;
 
+    // Zero-copy accessors: views into the row's own storage, valid as long
+    // as the row (or the Result holding it) is alive and not mutated
+    std::optional<std::string_view> get_text_view(size_t index) const;
+    std::optional<BlobView> get_blob_view(size_t index) const;
+
+    // Move-out accessors: transfer the cell's buffer to the caller without
+    // copying, leaving the cell empty (non-null)
+    std::optional<std::string> take_string(size_t index);
+    std::optional<std::vector<uint8_t>> take_blob(size_t index);
+
 private:
+    friend class Result;
+
+    // View mode: the row's cells live in the owning Result's flat cell
+    // store instead of a per-row vector (see Result's flat-cell ctor)
+    Row(Value* view, size_t count) : view_(view), view_count_(count) {}
+
+    const Value& cell(size_t index) const { return view_ ? view_[index] : values_[index]; }
+    Value& cell(size_t index) { return view_ ? view_[index] : values_[index]; }
+    size_t cell_count() const { return view_ ? view_count_ : values_.size(); }
+
     std::vector<Value> values_;
+    Value* view_ = nullptr;
+    size_t view_count_ = 0;
 };
 
 class PSR_API Result {
@@ -47,19 +78,42 @@ public:
     Result() = default;
     Result(std::vector<std::string> columns, std::vector<Row> rows);
 
+    // Arena-style storage: all cells live in one flat buffer (row i's cells
+    // at [i * columns, (i + 1) * columns)), released wholesale with the
+    // Result. Rows are lightweight views, so materializing a result costs
+    // O(log cells) allocations for buffer growth instead of one vector per
+    // row. Used by Database::execute.
+    Result(std::vector<std::string> columns, std::vector<Value> cells);
+
+    // Copies rebuild the row views onto the copied cell buffer; moves keep
+    // the buffer (and the views into it) intact
+    Result(const Result& other);
+    Result& operator=(const Result& other);
+    Result(Result&& other) = default;
+    Result& operator=(Result&& other) = default;
+
     bool empty() const;
     size_t row_count() const;
     size_t column_count() const;
 
     const std::vector<std::string>& columns() const;
     const Row& operator[](size_t index) const;
+    Row& operator[](size_t index);  // mutable access for move-out accessors
 
     // Iterator support
     auto begin() const { return rows_.begin(); }
     auto end() const { return rows_.end(); }
 
+    // Typed decoding into user structs (defined in row_decoder.h; requires
+    // a psr::row_binding<S> specialization)
+    template <typename S>
+    size_t decode(std::vector<S>& out) const;
+
 private:
+    void rebuild_views();
+
     std::vector<std::string> columns_;
+    std::vector<Value> cells_;  // flat storage backing view-mode rows
     std::vector<Row> rows_;
 };
 
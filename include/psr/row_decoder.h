@@ -0,0 +1,102 @@
+#ifndef PSR_DATABASE_ROW_DECODER_H
+#define PSR_DATABASE_ROW_DECODER_H
+
+#include "cursor.h"
+#include "result.h"
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace psr {
+
+// Column binding descriptor: lists a struct's members in result-column
+// order. Field i is decoded from column i.
+//
+//   struct Reading { int64_t id; std::string label; double value; };
+//   template <> struct psr::row_binding<Reading> {
+//       using columns = psr::columns<&Reading::id, &Reading::label, &Reading::value>;
+//   };
+//
+//   std::vector<Reading> readings;
+//   db.execute("SELECT id, label, value FROM t").decode(readings);
+//
+// Supported field types: integral, floating point and std::string.
+template <auto... Members>
+struct columns {
+    static constexpr size_t count = sizeof...(Members);
+
+    template <typename S, typename F>
+    static void for_each(S& target, F&& fn) {
+        size_t index = 0;
+        (fn(target.*Members, index++), ...);
+    }
+};
+
+// Specialize for each decodable struct, exposing a `columns` alias
+template <typename S>
+struct row_binding;
+
+// Appends one decoded struct per row; returns the number of rows decoded
+template <typename S>
+size_t Result::decode(std::vector<S>& out) const {
+    using Binding = typename row_binding<S>::columns;
+    static_assert(Binding::count > 0, "row_binding must list at least one column");
+
+    out.reserve(out.size() + row_count());
+    for (size_t r = 0; r < row_count(); ++r) {
+        const Row& row = (*this)[r];
+        S item{};
+        Binding::for_each(item, [&row](auto& field, size_t index) {
+            using Field = std::decay_t<decltype(field)>;
+            if constexpr (std::is_same_v<Field, std::string>) {
+                if (auto view = row.get_text_view(index)) {
+                    field.assign(view->data(), view->size());
+                }
+            } else if constexpr (std::is_floating_point_v<Field>) {
+                if (auto value = row.get_double(index)) {
+                    field = static_cast<Field>(*value);
+                } else {
+                    field = static_cast<Field>(row.get_int(index).value_or(0));
+                }
+            } else {
+                static_assert(std::is_integral_v<Field>, "Unsupported field type for row decoding");
+                field = static_cast<Field>(row.get_int(index).value_or(0));
+            }
+        });
+        out.push_back(std::move(item));
+    }
+    return row_count();
+}
+
+// Advances the cursor and decodes the current row; false when exhausted
+template <typename S>
+bool Cursor::next(S& out) {
+    using Binding = typename row_binding<S>::columns;
+    static_assert(Binding::count > 0, "row_binding must list at least one column");
+
+    if (!step()) {
+        return false;
+    }
+
+    Binding::for_each(out, [this](auto& field, size_t index) {
+        using Field = std::decay_t<decltype(field)>;
+        if constexpr (std::is_same_v<Field, std::string>) {
+            if (auto view = get_text(index)) {
+                field.assign(view->data(), view->size());
+            } else {
+                field.clear();
+            }
+        } else if constexpr (std::is_floating_point_v<Field>) {
+            field = static_cast<Field>(get_double(index).value_or(0.0));
+        } else {
+            static_assert(std::is_integral_v<Field>, "Unsupported field type for row decoding");
+            field = static_cast<Field>(get_int(index).value_or(0));
+        }
+    });
+    return true;
+}
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_ROW_DECODER_H
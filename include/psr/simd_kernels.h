@@ -0,0 +1,38 @@
+#ifndef PSR_DATABASE_SIMD_KERNELS_H
+#define PSR_DATABASE_SIMD_KERNELS_H
+
+#include "export.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace psr {
+namespace kernels {
+
+// Vectorized scan kernels over contiguous buffers, dispatched at runtime
+// (AVX2 on x86-64 when available, otherwise a scalar loop the compiler
+// auto-vectorizes for the baseline ISA, including NEON on aarch64). Used
+// by ColumnarResult's bulk helpers; usable directly on any dense buffer.
+
+struct MinMax {
+    double min = 0.0;
+    double max = 0.0;
+};
+
+PSR_API double sum(const double* data, size_t count);
+PSR_API MinMax min_max(const double* data, size_t count);
+
+// Index of the first element strictly above threshold, or -1
+PSR_API ptrdiff_t find_first_above(const double* data, size_t count, double threshold);
+
+// Number of set bits among the first `bits` bits of the bitmap
+PSR_API size_t popcount_bits(const uint8_t* bitmap, size_t bits);
+
+// Name of the dispatched implementation ("avx2" or "scalar"), for
+// diagnostics and tests
+PSR_API const char* active_implementation();
+
+}  // namespace kernels
+}  // namespace psr
+
+#endif  // PSR_DATABASE_SIMD_KERNELS_H
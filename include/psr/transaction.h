@@ -0,0 +1,52 @@
+#ifndef PSR_DATABASE_TRANSACTION_H
+#define PSR_DATABASE_TRANSACTION_H
+
+#include "export.h"
+
+#include <cstdint>
+#include <string>
+
+namespace psr {
+
+class Database;
+
+// RAII transaction guard. The outermost guard opens a real transaction;
+// nested guards use SQLite SAVEPOINTs, so an inner failure can roll back
+// without losing the outer transaction's work. A guard that goes out of
+// scope without commit() rolls its level back.
+//
+// The group-commit constructor turns a long ingest into a sequence of
+// real transactions: after every `auto_commit_operations` statements (or
+// `auto_commit_bytes` of bound parameter data, whichever comes first) the
+// open transaction is committed and a new one started, bounding how much
+// work a crash can lose while amortizing fsync cost. Group commit only
+// applies to the outermost guard.
+class PSR_API Transaction {
+public:
+    explicit Transaction(Database& db);
+    Transaction(Database& db, uint64_t auto_commit_operations, uint64_t auto_commit_bytes = 0);
+    ~Transaction();
+
+    // Non-copyable, non-movable (the guard is scope-bound)
+    Transaction(const Transaction&) = delete;
+    Transaction& operator=(const Transaction&) = delete;
+
+    // Commits this level (RELEASE for nested guards, COMMIT for the
+    // outermost); the guard becomes inactive
+    void commit();
+
+    // Rolls this level back explicitly
+    void rollback();
+
+    bool active() const { return active_; }
+
+private:
+    Database& db_;
+    int depth_;
+    bool active_;
+    std::string savepoint_;
+};
+
+}  // namespace psr
+
+#endif  // PSR_DATABASE_TRANSACTION_H
@@ -0,0 +1,85 @@
+#include "psr/blob_stream.h"
+
+#include <algorithm>
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace psr {
+
+struct BlobStream::Impl {
+    sqlite3* db = nullptr;
+    sqlite3_blob* blob = nullptr;
+
+    ~Impl() {
+        if (blob) {
+            sqlite3_blob_close(blob);
+        }
+    }
+};
+
+BlobStream::BlobStream(sqlite3* db, sqlite3_blob* blob) : impl_(std::make_unique<Impl>()) {
+    impl_->db = db;
+    impl_->blob = blob;
+}
+
+BlobStream::~BlobStream() = default;
+
+BlobStream::BlobStream(BlobStream&& other) noexcept = default;
+
+BlobStream& BlobStream::operator=(BlobStream&& other) noexcept = default;
+
+size_t BlobStream::size() const {
+    if (!impl_ || !impl_->blob) {
+        return 0;
+    }
+    return static_cast<size_t>(sqlite3_blob_bytes(impl_->blob));
+}
+
+size_t BlobStream::read(size_t offset, void* buffer, size_t length) const {
+    if (!impl_ || !impl_->blob) {
+        throw std::runtime_error("Blob stream is closed");
+    }
+
+    size_t total = size();
+    if (offset >= total) {
+        return 0;
+    }
+    size_t count = std::min(length, total - offset);
+    if (count == 0) {
+        return 0;
+    }
+
+    int rc = sqlite3_blob_read(impl_->blob, buffer, static_cast<int>(count), static_cast<int>(offset));
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to read blob: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+    return count;
+}
+
+void BlobStream::write(size_t offset, const void* data, size_t length) {
+    if (!impl_ || !impl_->blob) {
+        throw std::runtime_error("Blob stream is closed");
+    }
+
+    size_t total = size();
+    if (offset > total || length > total - offset) {
+        throw std::runtime_error("Blob write out of range (incremental writes cannot grow a blob)");
+    }
+    if (length == 0) {
+        return;
+    }
+
+    int rc = sqlite3_blob_write(impl_->blob, data, static_cast<int>(length), static_cast<int>(offset));
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to write blob: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+}
+
+void BlobStream::close() {
+    if (impl_ && impl_->blob) {
+        sqlite3_blob_close(impl_->blob);
+        impl_->blob = nullptr;
+    }
+}
+
+}  // namespace psr
@@ -0,0 +1,160 @@
+#include "psr/bulk_loader.h"
+
+#include <functional>
+#include <stdexcept>
+
+namespace psr {
+
+BulkLoader::BulkLoader(const std::string& path, size_t workers, LogLevel console_level) {
+    if (workers == 0) {
+        throw std::runtime_error("Worker count must be at least 1");
+    }
+
+    workers_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->db = std::make_unique<Database>(path, console_level, Durability::balanced);
+        workers_.push_back(std::move(worker));
+    }
+    for (auto& worker : workers_) {
+        worker->thread = std::thread([this, &w = *worker] { worker_loop(w); });
+    }
+}
+
+BulkLoader::~BulkLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+// Table affinity: one worker owns a table so its chunks apply in order
+size_t BulkLoader::worker_for_table(const std::string& collection, const std::string& group) const {
+    return std::hash<std::string>{}(collection + "\x1f" + group) % workers_.size();
+}
+
+void BulkLoader::enqueue_time_series(const std::string& collection, const std::string& group, int64_t element_id,
+                                     TimeSeries data) {
+    Chunk chunk;
+    chunk.is_time_series = true;
+    chunk.collection = collection;
+    chunk.group = group;
+    chunk.element_id = element_id;
+    chunk.series = std::move(data);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        workers_[worker_for_table(collection, group)]->queue.push_back(std::move(chunk));
+    }
+    work_cv_.notify_all();
+}
+
+void BulkLoader::enqueue_vectors(const std::string& collection, int64_t element_id,
+                                 std::vector<std::pair<std::string, Value>> fields) {
+    Chunk chunk;
+    chunk.collection = collection;
+    chunk.element_id = element_id;
+    chunk.fields = std::move(fields);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        workers_[worker_for_table(collection, "")]->queue.push_back(std::move(chunk));
+    }
+    work_cv_.notify_all();
+}
+
+void BulkLoader::worker_loop(Worker& worker) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        work_cv_.wait(lock, [&] { return stop_ || !worker.queue.empty(); });
+        if (worker.queue.empty()) {
+            if (stop_) {
+                return;
+            }
+            continue;
+        }
+
+        // Drain the worker's whole queue as one transaction
+        std::deque<Chunk> batch;
+        batch.swap(worker.queue);
+        worker.busy = true;
+        lock.unlock();
+
+        try {
+            // IMMEDIATE: take the write lock up front so the busy timeout
+            // applies; a deferred transaction that reads before writing
+            // would fail with SQLITE_BUSY_SNAPSHOT instead of waiting
+            worker.db->execute("BEGIN IMMEDIATE TRANSACTION");
+            for (const auto& chunk : batch) {
+                if (chunk.is_time_series) {
+                    worker.db->insert_time_series(chunk.collection, chunk.element_id,
+                                                  {{chunk.group, chunk.series}});
+                } else {
+                    worker.db->insert_vectors(chunk.collection, chunk.element_id, chunk.fields);
+                }
+            }
+            worker.db->commit();
+        } catch (const std::exception& e) {
+            try {
+                worker.db->rollback();
+            } catch (const std::exception&) {
+                // Connection-level failure; the original error is what matters
+            }
+            lock.lock();
+            if (first_error_.empty()) {
+                first_error_ = e.what();
+            }
+            worker.busy = false;
+            drained_cv_.notify_all();
+            continue;
+        }
+
+        lock.lock();
+        worker.busy = false;
+        if (worker.queue.empty()) {
+            drained_cv_.notify_all();
+        }
+    }
+}
+
+void BulkLoader::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_cv_.wait(lock, [&] {
+        for (const auto& worker : workers_) {
+            if (!worker->queue.empty() || worker->busy) {
+                return false;
+            }
+        }
+        return true;
+    });
+
+    if (!first_error_.empty()) {
+        std::string error;
+        error.swap(first_error_);
+        throw std::runtime_error("Bulk load failed: " + error);
+    }
+    lock.unlock();
+
+    // Final reconciliation: every connection must see the same schema
+    // version, and the loaded rows must satisfy foreign keys
+    int64_t version = workers_.front()->db->current_version();
+    for (auto& worker : workers_) {
+        if (worker->db->current_version() != version) {
+            throw std::runtime_error("Bulk load version mismatch across connections");
+        }
+    }
+
+    auto violations = workers_.front()->db->execute("PRAGMA foreign_key_check");
+    if (!violations.empty()) {
+        throw std::runtime_error("Bulk load produced " + std::to_string(violations.row_count()) +
+                                 " foreign key violation(s)");
+    }
+}
+
+}  // namespace psr
@@ -1,8 +1,10 @@
+#include "psr/blob_stream.h"
 #include "psr/c/database.h"
 #include "psr/c/result.h"
 #include "psr/database.h"
 #include "psr/result.h"
 
+#include <algorithm>
 #include <map>
 #include <new>
 #include <string>
@@ -28,13 +30,27 @@ psr::LogLevel to_cpp_log_level(psr_log_level_t level) {
     }
 }
 
+psr::Durability to_cpp_durability(psr_durability_t durability) {
+    switch (durability) {
+    case PSR_DURABILITY_FAST:
+        return psr::Durability::fast;
+    case PSR_DURABILITY_BALANCED:
+        return psr::Durability::balanced;
+    case PSR_DURABILITY_SAFE:
+        return psr::Durability::safe;
+    default:
+        return psr::Durability::balanced;
+    }
+}
+
 }  // anonymous namespace
 
 // Internal struct definitions
 struct psr_database {
     psr::Database db;
     std::string last_error;
-    psr_database(const std::string& path, psr::LogLevel level) : db(path, level) {}
+    psr_database(const std::string& path, psr::LogLevel level, psr::Durability durability)
+        : db(path, level, durability) {}
     psr_database(psr::Database&& database) : db(std::move(database)) {}
 };
 
@@ -52,11 +68,38 @@ struct psr_element {
     std::map<std::string, psr::TimeSeries> time_series;
 };
 
+struct psr_blob_stream {
+    psr::BlobStream stream;
+    explicit psr_blob_stream(psr::BlobStream s) : stream(std::move(s)) {}
+};
+
+struct psr_element_batch {
+    std::string table;
+    std::vector<std::string> columns;
+    // One slot per column for the row under construction; unset slots are
+    // omitted from the element so table defaults apply
+    std::vector<std::pair<bool, psr::Value>> current_row;
+    std::vector<std::vector<std::pair<std::string, psr::Value>>> rows;
+
+    psr_element_batch(std::string table_name, std::vector<std::string> column_names)
+        : table(std::move(table_name)), columns(std::move(column_names)), current_row(columns.size()) {}
+};
+
 extern "C" {
 
 // Database functions
 
 PSR_C_API psr_database_t* psr_database_open(const char* path, psr_log_level_t console_level, psr_error_t* error) {
+    return psr_database_open_with_profile(path, console_level, PSR_DURABILITY_BALANCED, error);
+}
+
+PSR_C_API psr_database_t* psr_database_from_schema(const char* db_path, const char* schema_path,
+                                                   psr_log_level_t console_level, psr_error_t* error) {
+    return psr_database_from_schema_with_profile(db_path, schema_path, console_level, PSR_DURABILITY_BALANCED, error);
+}
+
+PSR_C_API psr_database_t* psr_database_open_with_profile(const char* path, psr_log_level_t console_level,
+                                                         psr_durability_t durability, psr_error_t* error) {
     if (!path) {
         if (error)
             *error = PSR_ERROR_INVALID_ARGUMENT;
@@ -64,7 +107,7 @@ PSR_C_API psr_database_t* psr_database_open(const char* path, psr_log_level_t co
     }
 
     try {
-        auto* db = new psr_database(path, to_cpp_log_level(console_level));
+        auto* db = new psr_database(path, to_cpp_log_level(console_level), to_cpp_durability(durability));
         if (error)
             *error = PSR_OK;
         return db;
@@ -79,8 +122,9 @@ PSR_C_API psr_database_t* psr_database_open(const char* path, psr_log_level_t co
     }
 }
 
-PSR_C_API psr_database_t* psr_database_from_schema(const char* db_path, const char* schema_path,
-                                                   psr_log_level_t console_level, psr_error_t* error) {
+PSR_C_API psr_database_t* psr_database_from_schema_with_profile(const char* db_path, const char* schema_path,
+                                                                psr_log_level_t console_level,
+                                                                psr_durability_t durability, psr_error_t* error) {
     if (!db_path || !schema_path) {
         if (error)
             *error = PSR_ERROR_INVALID_ARGUMENT;
@@ -88,7 +132,8 @@ PSR_C_API psr_database_t* psr_database_from_schema(const char* db_path, const ch
     }
 
     try {
-        auto database = psr::Database::from_schema(db_path, schema_path, to_cpp_log_level(console_level));
+        auto database =
+            psr::Database::from_schema(db_path, schema_path, to_cpp_log_level(console_level), to_cpp_durability(durability));
         auto* db = new psr_database(std::move(database));
         if (error)
             *error = PSR_OK;
@@ -157,6 +202,30 @@ PSR_C_API int psr_database_changes(psr_database_t* db) {
     return db->db.changes();
 }
 
+PSR_C_API psr_error_t psr_database_submit(psr_database_t* db, const char* sql) {
+    if (!db || !sql)
+        return PSR_ERROR_INVALID_ARGUMENT;
+    try {
+        db->db.submit(sql);
+        return PSR_OK;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        return PSR_ERROR_QUERY;
+    }
+}
+
+PSR_C_API psr_error_t psr_database_flush(psr_database_t* db) {
+    if (!db)
+        return PSR_ERROR_INVALID_ARGUMENT;
+    try {
+        db->db.flush();
+        return PSR_OK;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        return PSR_ERROR_QUERY;
+    }
+}
+
 PSR_C_API psr_error_t psr_database_begin_transaction(psr_database_t* db) {
     if (!db)
         return PSR_ERROR_INVALID_ARGUMENT;
@@ -429,6 +498,183 @@ PSR_C_API int64_t psr_database_create_element(psr_database_t* db, const char* ta
     }
 }
 
+PSR_C_API psr_error_t psr_database_create_elements(psr_database_t* db, const char* table,
+                                                   psr_element_t* const* elements, size_t count, int64_t* rowids) {
+    if (!db || !table || (!elements && count > 0) || (!rowids && count > 0)) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (!elements[i]) {
+            return PSR_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    try {
+        std::vector<std::vector<std::pair<std::string, psr::Value>>> fields;
+        std::vector<std::map<std::string, psr::TimeSeries>> time_series;
+        fields.reserve(count);
+        time_series.reserve(count);
+
+        bool any_time_series = false;
+        for (size_t i = 0; i < count; ++i) {
+            fields.push_back(elements[i]->fields);
+            time_series.push_back(elements[i]->time_series);
+            if (!elements[i]->time_series.empty()) {
+                any_time_series = true;
+            }
+        }
+
+        std::vector<int64_t> ids;
+        if (any_time_series) {
+            ids = db->db.create_elements(table, fields, time_series);
+        } else {
+            ids = db->db.create_elements(table, fields);
+        }
+
+        for (size_t i = 0; i < ids.size(); ++i) {
+            rowids[i] = ids[i];
+        }
+        return PSR_OK;
+    } catch (const std::bad_alloc&) {
+        db->last_error = "Out of memory";
+        return PSR_ERROR_NO_MEMORY;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        return PSR_ERROR_QUERY;
+    }
+}
+
+// Element batch builder
+
+PSR_C_API psr_element_batch_t* psr_element_batch_create(const char* table, const char** columns,
+                                                        size_t column_count) {
+    if (!table || (!columns && column_count > 0) || column_count == 0) {
+        return nullptr;
+    }
+
+    try {
+        std::vector<std::string> names;
+        names.reserve(column_count);
+        for (size_t i = 0; i < column_count; ++i) {
+            if (!columns[i]) {
+                return nullptr;
+            }
+            names.emplace_back(columns[i]);
+        }
+        return new psr_element_batch(table, std::move(names));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+PSR_C_API void psr_element_batch_free(psr_element_batch_t* batch) {
+    delete batch;
+}
+
+PSR_C_API size_t psr_element_batch_row_count(psr_element_batch_t* batch) {
+    return batch ? batch->rows.size() : 0;
+}
+
+namespace {
+
+psr_error_t batch_set(psr_element_batch_t* batch, size_t column, psr::Value value) {
+    if (!batch || column >= batch->columns.size()) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+    batch->current_row[column] = {true, std::move(value)};
+    return PSR_OK;
+}
+
+}  // anonymous namespace
+
+PSR_C_API psr_error_t psr_batch_append_null(psr_element_batch_t* batch, size_t column) {
+    return batch_set(batch, column, nullptr);
+}
+
+PSR_C_API psr_error_t psr_batch_append_int64(psr_element_batch_t* batch, size_t column, int64_t value) {
+    return batch_set(batch, column, value);
+}
+
+PSR_C_API psr_error_t psr_batch_append_double(psr_element_batch_t* batch, size_t column, double value) {
+    return batch_set(batch, column, value);
+}
+
+PSR_C_API psr_error_t psr_batch_append_text(psr_element_batch_t* batch, size_t column, const char* value) {
+    if (!value) {
+        return batch_set(batch, column, nullptr);
+    }
+    return batch_set(batch, column, std::string(value));
+}
+
+PSR_C_API psr_error_t psr_batch_append_int64_array(psr_element_batch_t* batch, size_t column, const int64_t* values,
+                                                   size_t count) {
+    std::vector<int64_t> vec;
+    if (values && count > 0) {
+        vec.assign(values, values + count);
+    }
+    return batch_set(batch, column, std::move(vec));
+}
+
+PSR_C_API psr_error_t psr_batch_append_double_array(psr_element_batch_t* batch, size_t column, const double* values,
+                                                    size_t count) {
+    std::vector<double> vec;
+    if (values && count > 0) {
+        vec.assign(values, values + count);
+    }
+    return batch_set(batch, column, std::move(vec));
+}
+
+PSR_C_API psr_error_t psr_batch_row_finish(psr_element_batch_t* batch) {
+    if (!batch) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+
+    std::vector<std::pair<std::string, psr::Value>> fields;
+    fields.reserve(batch->columns.size());
+    for (size_t i = 0; i < batch->columns.size(); ++i) {
+        auto& [set, value] = batch->current_row[i];
+        if (set) {
+            fields.emplace_back(batch->columns[i], std::move(value));
+            set = false;
+        }
+    }
+
+    if (fields.empty()) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+
+    batch->rows.push_back(std::move(fields));
+    return PSR_OK;
+}
+
+PSR_C_API psr_error_t psr_database_batch_flush(psr_database_t* db, psr_element_batch_t* batch, int64_t* rowids) {
+    if (!db || !batch) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (batch->rows.empty()) {
+        return PSR_OK;
+    }
+
+    try {
+        auto ids = db->db.create_elements(batch->table, batch->rows);
+        if (rowids) {
+            for (size_t i = 0; i < ids.size(); ++i) {
+                rowids[i] = ids[i];
+            }
+        }
+        batch->rows.clear();
+        return PSR_OK;
+    } catch (const std::bad_alloc&) {
+        db->last_error = "Out of memory";
+        return PSR_ERROR_NO_MEMORY;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        return PSR_ERROR_QUERY;
+    }
+}
+
 PSR_C_API int64_t psr_database_get_element_id(psr_database_t* db, const char* collection, const char* label,
                                               psr_error_t* error) {
     if (!db || !collection || !label) {
@@ -450,6 +696,132 @@ PSR_C_API int64_t psr_database_get_element_id(psr_database_t* db, const char* co
     }
 }
 
+PSR_C_API psr_error_t psr_database_set_change_callback(psr_database_t* db, psr_change_callback_t callback,
+                                                       void* context) {
+    if (!db)
+        return PSR_ERROR_INVALID_ARGUMENT;
+
+    if (!callback) {
+        db->db.set_change_callback(nullptr);
+        db->db.set_change_tracking(false);
+        return PSR_OK;
+    }
+
+    db->db.set_change_tracking(true);
+    db->db.set_change_callback([callback, context](const psr::Change& change) {
+        callback(context, change.table.c_str(), change.rowid, static_cast<int>(change.op));
+    });
+    return PSR_OK;
+}
+
+PSR_C_API psr_error_t psr_database_backup(psr_database_t* db, const char* path) {
+    if (!db || !path)
+        return PSR_ERROR_INVALID_ARGUMENT;
+    try {
+        db->db.backup_to(path);
+        return PSR_OK;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        return PSR_ERROR_QUERY;
+    }
+}
+
+// Incremental blob I/O
+
+PSR_C_API psr_blob_stream_t* psr_database_open_blob(psr_database_t* db, const char* table, const char* column,
+                                                    int64_t rowid, int writable, psr_error_t* error) {
+    if (!db || !table || !column) {
+        if (error)
+            *error = PSR_ERROR_INVALID_ARGUMENT;
+        return nullptr;
+    }
+
+    try {
+        auto stream = db->db.open_blob(table, column, rowid, writable != 0);
+        auto* handle = new psr_blob_stream(std::move(stream));
+        if (error)
+            *error = PSR_OK;
+        return handle;
+    } catch (const std::bad_alloc&) {
+        if (error)
+            *error = PSR_ERROR_NO_MEMORY;
+        return nullptr;
+    } catch (const std::exception& e) {
+        db->last_error = e.what();
+        if (error)
+            *error = PSR_ERROR_QUERY;
+        return nullptr;
+    }
+}
+
+PSR_C_API void psr_blob_stream_free(psr_blob_stream_t* stream) {
+    delete stream;
+}
+
+PSR_C_API size_t psr_blob_stream_size(psr_blob_stream_t* stream) {
+    return stream ? stream->stream.size() : 0;
+}
+
+PSR_C_API size_t psr_blob_stream_read(psr_blob_stream_t* stream, size_t offset, uint8_t* buffer, size_t length) {
+    if (!stream || !buffer) {
+        return 0;
+    }
+    try {
+        return stream->stream.read(offset, buffer, length);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+PSR_C_API psr_error_t psr_blob_stream_write(psr_blob_stream_t* stream, size_t offset, const uint8_t* data,
+                                            size_t length) {
+    if (!stream || (!data && length > 0)) {
+        return PSR_ERROR_INVALID_ARGUMENT;
+    }
+    try {
+        stream->stream.write(offset, data, length);
+        return PSR_OK;
+    } catch (const std::exception&) {
+        return PSR_ERROR_QUERY;
+    }
+}
+
+namespace {
+
+void copy_operation_stats(const psr::DatabaseStats::Operation& in, psr_operation_stats_t* out) {
+    out->count = in.count;
+    out->total_us = in.total_us;
+    out->max_us = in.max_us;
+    for (size_t i = 0; i < in.histogram.size(); ++i) {
+        out->histogram[i] = in.histogram[i];
+    }
+}
+
+}  // anonymous namespace
+
+PSR_C_API psr_error_t psr_database_set_stats_enabled(psr_database_t* db, int enabled) {
+    if (!db)
+        return PSR_ERROR_INVALID_ARGUMENT;
+    db->db.set_stats_enabled(enabled != 0);
+    return PSR_OK;
+}
+
+PSR_C_API psr_error_t psr_database_get_stats(psr_database_t* db, psr_database_stats_t* out) {
+    if (!db || !out)
+        return PSR_ERROR_INVALID_ARGUMENT;
+
+    auto stats = db->db.stats();
+    copy_operation_stats(stats.prepare, &out->prepare);
+    copy_operation_stats(stats.bind, &out->bind);
+    copy_operation_stats(stats.step, &out->step);
+    copy_operation_stats(stats.commit, &out->commit);
+    copy_operation_stats(stats.migration, &out->migration);
+    copy_operation_stats(stats.introspection, &out->introspection);
+    out->query_cache_hits = stats.query_cache_hits;
+    out->query_cache_misses = stats.query_cache_misses;
+    return PSR_OK;
+}
+
 PSR_C_API const char* psr_error_string(psr_error_t error) {
     switch (error) {
     case PSR_OK:
@@ -586,4 +958,74 @@ PSR_C_API const uint8_t* psr_result_get_blob(psr_result_t* result, size_t row, s
     return nullptr;
 }
 
+PSR_C_API const char* psr_result_get_text_ref(psr_result_t* result, size_t row, size_t col, size_t* size) {
+    if (size)
+        *size = 0;
+    if (!result || row >= result->result.row_count() || col >= result->result.column_count()) {
+        return nullptr;
+    }
+
+    auto view = result->result[row].get_text_view(col);
+    if (!view) {
+        return nullptr;
+    }
+    if (size)
+        *size = view->size();
+    return view->data();
+}
+
+PSR_C_API const uint8_t* psr_result_get_blob_ref(psr_result_t* result, size_t row, size_t col, size_t* size) {
+    if (size)
+        *size = 0;
+    if (!result || row >= result->result.row_count() || col >= result->result.column_count()) {
+        return nullptr;
+    }
+
+    auto view = result->result[row].get_blob_view(col);
+    if (!view) {
+        return nullptr;
+    }
+    if (size)
+        *size = view->size;
+    return view->data;
+}
+
+PSR_C_API size_t psr_result_copy_column_doubles(psr_result_t* result, size_t col, double* out, size_t n) {
+    if (!result || !out || col >= result->result.column_count()) {
+        return 0;
+    }
+
+    size_t count = std::min(n, result->result.row_count());
+    for (size_t row = 0; row < count; ++row) {
+        const auto& value = result->result[row][col];
+        if (const auto* d = std::get_if<double>(&value)) {
+            out[row] = *d;
+        } else if (const auto* i = std::get_if<int64_t>(&value)) {
+            out[row] = static_cast<double>(*i);
+        } else {
+            out[row] = 0.0;
+        }
+    }
+    return count;
+}
+
+PSR_C_API size_t psr_result_copy_column_ints(psr_result_t* result, size_t col, int64_t* out, size_t n) {
+    if (!result || !out || col >= result->result.column_count()) {
+        return 0;
+    }
+
+    size_t count = std::min(n, result->result.row_count());
+    for (size_t row = 0; row < count; ++row) {
+        const auto& value = result->result[row][col];
+        if (const auto* i = std::get_if<int64_t>(&value)) {
+            out[row] = *i;
+        } else if (const auto* d = std::get_if<double>(&value)) {
+            out[row] = static_cast<int64_t>(*d);
+        } else {
+            out[row] = 0;
+        }
+    }
+    return count;
+}
+
 }  // extern "C"
@@ -0,0 +1,155 @@
+#include "psr/columnar_result.h"
+
+#include "psr/simd_kernels.h"
+
+#include <stdexcept>
+
+namespace psr {
+
+ColumnarResult::ColumnType ColumnarResult::column_type(size_t col) const {
+    return checked_column(col).type;
+}
+
+const ColumnarResult::Column& ColumnarResult::checked_column(size_t col) const {
+    if (col >= columns_.size()) {
+        throw std::out_of_range("Column index out of range");
+    }
+    return columns_[col];
+}
+
+bool ColumnarResult::is_null(size_t col, size_t row) const {
+    const auto& column = checked_column(col);
+    if (row >= row_count_) {
+        return true;
+    }
+    return (column.nulls[row / 8] >> (row % 8)) & 1;
+}
+
+const std::vector<int64_t>& ColumnarResult::int_column(size_t col) const {
+    const auto& column = checked_column(col);
+    if (column.type != ColumnType::integer) {
+        throw std::runtime_error("Column is not INTEGER: " + names_[col]);
+    }
+    return column.ints;
+}
+
+const std::vector<double>& ColumnarResult::double_column(size_t col) const {
+    const auto& column = checked_column(col);
+    if (column.type != ColumnType::real) {
+        throw std::runtime_error("Column is not REAL: " + names_[col]);
+    }
+    return column.reals;
+}
+
+std::string_view ColumnarResult::text(size_t col, size_t row) const {
+    const auto& column = checked_column(col);
+    if (column.type != ColumnType::text) {
+        throw std::runtime_error("Column is not TEXT: " + names_[col]);
+    }
+    if (row >= row_count_) {
+        throw std::out_of_range("Row index out of range");
+    }
+    size_t begin = column.offsets[row];
+    return std::string_view(column.arena.data() + begin, column.offsets[row + 1] - begin);
+}
+
+BlobView ColumnarResult::blob(size_t col, size_t row) const {
+    const auto& column = checked_column(col);
+    if (column.type != ColumnType::blob) {
+        throw std::runtime_error("Column is not BLOB: " + names_[col]);
+    }
+    if (row >= row_count_) {
+        throw std::out_of_range("Row index out of range");
+    }
+    size_t begin = column.offsets[row];
+    BlobView view;
+    view.data = reinterpret_cast<const uint8_t*>(column.arena.data()) + begin;
+    view.size = column.offsets[row + 1] - begin;
+    return view;
+}
+
+double ColumnarResult::column_sum(size_t col) const {
+    const auto& values = double_column(col);
+    return kernels::sum(values.data(), values.size());
+}
+
+std::pair<double, double> ColumnarResult::column_min_max(size_t col) const {
+    const auto& values = double_column(col);
+    auto result = kernels::min_max(values.data(), values.size());
+    return {result.min, result.max};
+}
+
+ptrdiff_t ColumnarResult::find_first_above(size_t col, double threshold) const {
+    const auto& values = double_column(col);
+    return kernels::find_first_above(values.data(), values.size(), threshold);
+}
+
+size_t ColumnarResult::null_count(size_t col) const {
+    const auto& column = checked_column(col);
+    return kernels::popcount_bits(column.nulls.data(), row_count_);
+}
+
+void ColumnarResult::set_columns(std::vector<std::string> names) {
+    names_ = std::move(names);
+    columns_.resize(names_.size());
+}
+
+// Fixes a column's type, backfilling slots for rows appended while the
+// column had only seen nulls
+void ColumnarResult::decide_type(size_t col, ColumnType type) {
+    auto& column = columns_[col];
+    column.type = type;
+    switch (type) {
+    case ColumnType::integer:
+        column.ints.assign(row_count_, 0);
+        break;
+    case ColumnType::real:
+        column.reals.assign(row_count_, 0.0);
+        break;
+    case ColumnType::text:
+    case ColumnType::blob:
+        column.offsets.assign(row_count_ + 1, 0);
+        break;
+    case ColumnType::null:
+        break;
+    }
+}
+
+void ColumnarResult::append_int(size_t col, int64_t value) {
+    columns_[col].ints.push_back(value);
+    columns_[col].nulls.resize((row_count_ + 8) / 8, 0);
+}
+
+void ColumnarResult::append_double(size_t col, double value) {
+    columns_[col].reals.push_back(value);
+    columns_[col].nulls.resize((row_count_ + 8) / 8, 0);
+}
+
+void ColumnarResult::append_bytes(size_t col, const char* data, size_t size) {
+    auto& column = columns_[col];
+    column.arena.append(data, size);
+    column.offsets.push_back(column.arena.size());
+    column.nulls.resize((row_count_ + 8) / 8, 0);
+}
+
+void ColumnarResult::append_null(size_t col) {
+    auto& column = columns_[col];
+    switch (column.type) {
+    case ColumnType::integer:
+        column.ints.push_back(0);
+        break;
+    case ColumnType::real:
+        column.reals.push_back(0.0);
+        break;
+    case ColumnType::text:
+    case ColumnType::blob:
+        column.offsets.push_back(column.arena.size());
+        break;
+    case ColumnType::null:
+        break;
+    }
+    column.nulls.resize((row_count_ + 8) / 8, 0);
+    column.nulls[row_count_ / 8] |= static_cast<uint8_t>(1u << (row_count_ % 8));
+}
+
+}  // namespace psr
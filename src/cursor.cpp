@@ -0,0 +1,131 @@
+#include "psr/cursor.h"
+
+#include <mutex>
+#include <sqlite3.h>
+#include <stdexcept>
+
+namespace psr {
+
+struct Cursor::Impl {
+    sqlite3* db = nullptr;
+    sqlite3_stmt* stmt = nullptr;
+    std::recursive_mutex* db_mutex = nullptr;
+    std::vector<std::string> columns;
+    bool done = false;
+
+    ~Impl() {
+        if (stmt) {
+            sqlite3_finalize(stmt);
+        }
+    }
+};
+
+Cursor::Cursor(sqlite3* db, sqlite3_stmt* stmt, std::recursive_mutex* db_mutex) : impl_(std::make_unique<Impl>()) {
+    impl_->db = db;
+    impl_->stmt = stmt;
+    impl_->db_mutex = db_mutex;
+
+    int col_count = sqlite3_column_count(stmt);
+    impl_->columns.reserve(col_count);
+    for (int i = 0; i < col_count; ++i) {
+        const char* name = sqlite3_column_name(stmt, i);
+        impl_->columns.emplace_back(name ? name : "");
+    }
+}
+
+Cursor::~Cursor() = default;
+
+Cursor::Cursor(Cursor&& other) noexcept = default;
+
+Cursor& Cursor::operator=(Cursor&& other) noexcept = default;
+
+bool Cursor::step() {
+    if (!impl_ || impl_->done) {
+        return false;
+    }
+
+    // Acquire the connection mutex before stepping: a write statement's
+    // update hook locks it, and stepping without it would take SQLite's
+    // own connection mutex first - the reverse order of execute() - and
+    // deadlock against a concurrent statement
+    std::lock_guard<std::recursive_mutex> lock(*impl_->db_mutex);
+
+    int rc = sqlite3_step(impl_->stmt);
+    if (rc == SQLITE_ROW) {
+        return true;
+    }
+
+    impl_->done = true;
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to step cursor: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+    return false;
+}
+
+bool Cursor::done() const {
+    return !impl_ || impl_->done;
+}
+
+size_t Cursor::column_count() const {
+    return impl_ ? impl_->columns.size() : 0;
+}
+
+const std::vector<std::string>& Cursor::columns() const {
+    static const std::vector<std::string> empty;
+    return impl_ ? impl_->columns : empty;
+}
+
+bool Cursor::is_null(size_t index) const {
+    if (!impl_ || index >= impl_->columns.size()) {
+        return true;
+    }
+    return sqlite3_column_type(impl_->stmt, static_cast<int>(index)) == SQLITE_NULL;
+}
+
+std::optional<int64_t> Cursor::get_int(size_t index) const {
+    if (!impl_ || index >= impl_->columns.size()) {
+        return std::nullopt;
+    }
+    if (sqlite3_column_type(impl_->stmt, static_cast<int>(index)) != SQLITE_INTEGER) {
+        return std::nullopt;
+    }
+    return sqlite3_column_int64(impl_->stmt, static_cast<int>(index));
+}
+
+std::optional<double> Cursor::get_double(size_t index) const {
+    if (!impl_ || index >= impl_->columns.size()) {
+        return std::nullopt;
+    }
+    int type = sqlite3_column_type(impl_->stmt, static_cast<int>(index));
+    if (type != SQLITE_FLOAT && type != SQLITE_INTEGER) {
+        return std::nullopt;
+    }
+    return sqlite3_column_double(impl_->stmt, static_cast<int>(index));
+}
+
+std::optional<std::string_view> Cursor::get_text(size_t index) const {
+    if (!impl_ || index >= impl_->columns.size()) {
+        return std::nullopt;
+    }
+    if (sqlite3_column_type(impl_->stmt, static_cast<int>(index)) != SQLITE_TEXT) {
+        return std::nullopt;
+    }
+    const char* text = reinterpret_cast<const char*>(sqlite3_column_text(impl_->stmt, static_cast<int>(index)));
+    int size = sqlite3_column_bytes(impl_->stmt, static_cast<int>(index));
+    return std::string_view(text ? text : "", static_cast<size_t>(size));
+}
+
+std::optional<BlobView> Cursor::get_blob(size_t index) const {
+    if (!impl_ || index >= impl_->columns.size()) {
+        return std::nullopt;
+    }
+    if (sqlite3_column_type(impl_->stmt, static_cast<int>(index)) != SQLITE_BLOB) {
+        return std::nullopt;
+    }
+    BlobView view;
+    view.data = reinterpret_cast<const uint8_t*>(sqlite3_column_blob(impl_->stmt, static_cast<int>(index)));
+    view.size = static_cast<size_t>(sqlite3_column_bytes(impl_->stmt, static_cast<int>(index)));
+    return view;
+}
+
+}  // namespace psr
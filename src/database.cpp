@@ -1,10 +1,19 @@
+#include "psr/blob_stream.h"
 #include "psr/database.h"
+#include "psr/transaction.h"
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
 #include <limits>
+#include <list>
+#include <mutex>
 #include <set>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -12,6 +21,8 @@
 #include <sqlite3.h>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 
 namespace {
 
@@ -34,6 +45,24 @@ spdlog::level::level_enum to_spdlog_level(psr::LogLevel level) {
     }
 }
 
+// Process-wide file sink registry: databases logging to the same file
+// share one open sink instead of re-opening it per connection
+std::shared_ptr<spdlog::sinks::basic_file_sink_mt> shared_file_sink(const std::string& log_file_path) {
+    static std::mutex registry_mutex;
+    static std::map<std::string, std::weak_ptr<spdlog::sinks::basic_file_sink_mt>> registry;
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto& slot = registry[log_file_path];
+    if (auto sink = slot.lock()) {
+        return sink;
+    }
+
+    auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
+    sink->set_level(spdlog::level::debug);
+    slot = sink;
+    return sink;
+}
+
 std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_path, psr::LogLevel console_level) {
     namespace fs = std::filesystem;
 
@@ -41,6 +70,14 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
     uint64_t id = g_logger_counter.fetch_add(1);
     std::string logger_name = "psr_database_" + std::to_string(id);
 
+    // Fast path for silenced databases (scratch instances): no filesystem
+    // probe, no sinks at all
+    if (console_level == psr::LogLevel::off) {
+        auto logger = std::make_shared<spdlog::logger>(logger_name);
+        logger->set_level(spdlog::level::off);
+        return logger;
+    }
+
     // Create console sink (thread-safe)
     auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
     console_sink->set_level(to_spdlog_level(console_level));
@@ -61,11 +98,10 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
         log_file_path = (db_dir / "psr_database.log").string();
     }
 
-    // Create file sink (thread-safe)
+    // Shared file sink (thread-safe)
     std::shared_ptr<spdlog::sinks::basic_file_sink_mt> file_sink;
     try {
-        file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_file_path, true);
-        file_sink->set_level(spdlog::level::debug);
+        file_sink = shared_file_sink(log_file_path);
     } catch (const spdlog::spdlog_ex& ex) {
         // If file sink creation fails, continue with console-only logging
         auto logger = std::make_shared<spdlog::logger>(logger_name, console_sink);
@@ -82,6 +118,253 @@ std::shared_ptr<spdlog::logger> create_database_logger(const std::string& db_pat
     return logger;
 }
 
+// Heuristic DDL detection used to invalidate the schema metadata cache:
+// any statement that can change the schema starts with one of these verbs
+bool is_ddl_statement(const std::string& sql) {
+    // Skip leading whitespace and SQL comments to find the statement verb
+    size_t pos = 0;
+    while (pos < sql.size()) {
+        pos = sql.find_first_not_of(" \t\r\n", pos);
+        if (pos == std::string::npos) {
+            return false;
+        }
+        if (sql.compare(pos, 2, "--") == 0) {
+            pos = sql.find('\n', pos);
+            if (pos == std::string::npos) {
+                return false;
+            }
+        } else if (sql.compare(pos, 2, "/*") == 0) {
+            pos = sql.find("*/", pos + 2);
+            if (pos == std::string::npos) {
+                return false;
+            }
+            pos += 2;
+        } else {
+            break;
+        }
+    }
+
+    static const char* ddl_verbs[] = {"CREATE", "ALTER", "DROP"};
+    for (const char* verb : ddl_verbs) {
+        size_t len = std::strlen(verb);
+        if (sql.size() >= pos + len && std::equal(verb, verb + len, sql.begin() + pos, [](char a, char b) {
+                return a == std::toupper(static_cast<unsigned char>(b));
+            })) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Cache key for the query result cache: SQL plus a tagged serialization
+// of every parameter. Every field is framed as tag + byte count + ':' +
+// bytes, so the encoding is injective - parameter bytes can never be
+// confused with framing, and distinct parameter lists cannot collide.
+std::string query_cache_key(const std::string& sql, const std::vector<psr::Value>& params) {
+    std::string key;
+    auto append_framed = [&key](char tag, const char* data, size_t size) {
+        key += tag;
+        key += std::to_string(size);
+        key += ':';
+        key.append(data, size);
+    };
+
+    append_framed('q', sql.data(), sql.size());
+    for (const auto& param : params) {
+        std::visit(
+            [&](auto&& arg) {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                    append_framed('n', "", 0);
+                } else if constexpr (std::is_same_v<T, int64_t>) {
+                    std::string text = std::to_string(arg);
+                    append_framed('i', text.data(), text.size());
+                } else if constexpr (std::is_same_v<T, double>) {
+                    std::string text = std::to_string(arg);
+                    append_framed('d', text.data(), text.size());
+                } else if constexpr (std::is_same_v<T, std::string>) {
+                    append_framed('s', arg.data(), arg.size());
+                } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
+                    append_framed('b', reinterpret_cast<const char*>(arg.data()), arg.size());
+                } else {
+                    append_framed('?', "", 0);
+                }
+            },
+            param);
+    }
+    return key;
+}
+
+// Rough footprint of a cached result for byte-budget accounting
+size_t estimate_result_bytes(const psr::Result& result) {
+    size_t bytes = result.row_count() * result.column_count() * sizeof(psr::Value);
+    for (size_t r = 0; r < result.row_count(); ++r) {
+        for (size_t c = 0; c < result.column_count(); ++c) {
+            if (auto text = result[r].get_text_view(c)) {
+                bytes += text->size();
+            } else if (auto blob = result[r].get_blob_view(c)) {
+                bytes += blob->size;
+            }
+        }
+    }
+    return bytes;
+}
+
+// Bind positional parameters to a prepared statement (1-indexed).
+//
+// `lifetime` is SQLITE_STATIC when the caller keeps `params` alive through
+// the whole step loop (execute, execute_batch, the async writer), which
+// lets SQLite read text/blob bytes in place instead of copying them. Pass
+// SQLITE_TRANSIENT when stepping outlives the params (cursors).
+void bind_parameters(sqlite3_stmt* stmt, const std::vector<psr::Value>& params,
+                     sqlite3_destructor_type lifetime = SQLITE_STATIC) {
+    for (size_t i = 0; i < params.size(); ++i) {
+        int idx = static_cast<int>(i + 1);
+        const auto& param = params[i];
+
+        std::visit(
+            [&](auto&& arg) {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::nullptr_t>) {
+                    sqlite3_bind_null(stmt, idx);
+                } else if constexpr (std::is_same_v<T, int64_t>) {
+                    sqlite3_bind_int64(stmt, idx, arg);
+                } else if constexpr (std::is_same_v<T, double>) {
+                    sqlite3_bind_double(stmt, idx, arg);
+                } else if constexpr (std::is_same_v<T, std::string>) {
+                    sqlite3_bind_text(stmt, idx, arg.c_str(), static_cast<int>(arg.size()), lifetime);
+                } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
+                    sqlite3_bind_blob(stmt, idx, arg.data(), static_cast<int>(arg.size()), lifetime);
+                }
+            },
+            param);
+    }
+}
+
+// Coherent PRAGMA preset for each durability profile (see Durability
+// docs). Pragmas that change the database file itself cannot run on
+// read-only connections and are marked so they can be skipped there.
+struct ProfilePragma {
+    const char* sql;
+    bool requires_write;
+};
+
+std::vector<ProfilePragma> connection_profile_pragmas(psr::Durability durability) {
+    switch (durability) {
+    case psr::Durability::fast:
+        return {{"PRAGMA journal_mode = WAL", true},
+                {"PRAGMA synchronous = OFF", false},
+                {"PRAGMA cache_size = -262144", false},
+                {"PRAGMA mmap_size = 1073741824", false},
+                {"PRAGMA temp_store = MEMORY", false},
+                {"PRAGMA busy_timeout = 5000", false}};
+    case psr::Durability::balanced:
+        return {{"PRAGMA journal_mode = WAL", true},
+                {"PRAGMA synchronous = NORMAL", false},
+                {"PRAGMA cache_size = -65536", false},
+                {"PRAGMA mmap_size = 268435456", false},
+                {"PRAGMA temp_store = MEMORY", false},
+                {"PRAGMA busy_timeout = 5000", false}};
+    case psr::Durability::safe:
+    default:
+        return {{"PRAGMA journal_mode = DELETE", true},
+                {"PRAGMA synchronous = FULL", false},
+                {"PRAGMA busy_timeout = 5000", false}};
+    }
+}
+
+// Extracts the column names a statement filters on: identifiers in the
+// WHERE clause that are directly followed by a comparison operator. A
+// heuristic, but good enough to name the column behind a full scan.
+std::vector<std::string> filtered_columns(const std::string& sql) {
+    std::string lower(sql.size(), '\0');
+    std::transform(sql.begin(), sql.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    size_t where_pos = lower.find(" where ");
+    if (where_pos == std::string::npos) {
+        return {};
+    }
+
+    std::vector<std::string> columns;
+    size_t i = where_pos + 7;
+    while (i < sql.size()) {
+        if (std::isalpha(static_cast<unsigned char>(sql[i])) || sql[i] == '_' || sql[i] == '"') {
+            bool quoted = sql[i] == '"';
+            if (quoted) {
+                ++i;
+            }
+            size_t begin = i;
+            while (i < sql.size() &&
+                   (std::isalnum(static_cast<unsigned char>(sql[i])) || sql[i] == '_' || sql[i] == '.')) {
+                ++i;
+            }
+            std::string token = sql.substr(begin, i - begin);
+            if (quoted && i < sql.size() && sql[i] == '"') {
+                ++i;
+            }
+
+            // Comparison operator directly after the identifier?
+            size_t j = sql.find_first_not_of(" \t\r\n", i);
+            if (j != std::string::npos &&
+                (sql[j] == '=' || sql[j] == '<' || sql[j] == '>' ||
+                 lower.compare(j, 5, "like ") == 0 || lower.compare(j, 3, "in ") == 0 ||
+                 lower.compare(j, 3, "in(") == 0)) {
+                // Strip a table qualifier
+                size_t dot = token.rfind('.');
+                if (dot != std::string::npos) {
+                    token = token.substr(dot + 1);
+                }
+                columns.push_back(token);
+            }
+        } else {
+            ++i;
+        }
+    }
+    return columns;
+}
+
+constexpr const char* migration_bundle_magic = "PSR_MIGRATION_BUNDLE 1";
+
+// Loads (version, sql) pairs from a packed bundle file (see
+// Database::pack_migrations for the writer side)
+std::vector<std::pair<int64_t, std::string>> read_migration_bundle(const std::string& bundle_path) {
+    std::ifstream file(bundle_path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Failed to open migration bundle: " + bundle_path);
+    }
+
+    std::string magic;
+    std::getline(file, magic);
+    if (magic != migration_bundle_magic) {
+        throw std::runtime_error("Not a migration bundle: " + bundle_path);
+    }
+
+    std::vector<std::pair<int64_t, std::string>> migrations;
+    std::string header;
+    while (std::getline(file, header)) {
+        if (header.empty()) {
+            continue;
+        }
+        std::istringstream parts(header);
+        int64_t version = 0;
+        size_t length = 0;
+        if (!(parts >> version >> length)) {
+            throw std::runtime_error("Corrupt migration bundle header: " + bundle_path);
+        }
+
+        std::string sql(length, '\0');
+        file.read(sql.data(), static_cast<std::streamsize>(length));
+        if (file.gcount() != static_cast<std::streamsize>(length)) {
+            throw std::runtime_error("Truncated migration bundle: " + bundle_path);
+        }
+        file.get();  // trailing newline
+
+        migrations.emplace_back(version, std::move(sql));
+    }
+    return migrations;
+}
+
 }  // anonymous namespace
 
 namespace psr {
@@ -91,25 +374,482 @@ struct Database::Impl {
     std::string path;
     std::string schema_path;
     std::string last_error;
+    LogLevel console_level = LogLevel::info;
+
+    // Logger built on first use so scratch databases never pay for sink
+    // setup (and LogLevel::off skips it entirely). call_once makes the
+    // lazy initialization safe against concurrent first logging without
+    // an unsynchronized shared_ptr read.
+    std::once_flag logger_once;
     std::shared_ptr<spdlog::logger> logger;
+    spdlog::logger* log() {
+        std::call_once(logger_once, [this] { logger = create_database_logger(path, console_level); });
+        return logger.get();
+    }
+
+    // Prepared statement cache (LRU, keyed by SQL text). Statements stay
+    // prepared across execute() calls and are reset/rebound on reuse. The
+    // read set captured at prepare time lives with its statement so it is
+    // never lost (or left default-empty) while the statement is cached.
+    static constexpr size_t statement_cache_capacity = 64;
+    struct CachedStatement {
+        std::string sql;
+        sqlite3_stmt* stmt = nullptr;
+        std::set<std::string> read_set;  // tables the statement reads
+    };
+    std::list<CachedStatement> statement_lru;
+    std::unordered_map<std::string, std::list<CachedStatement>::iterator> statement_cache;
+    StatementCacheStats statement_stats;
+
+    // Schema metadata cache: PRAGMA introspection results per table, plus
+    // satellite-table listings per name prefix. Built lazily and invalidated
+    // whenever the schema can change (DDL statements, migrations).
+    // Compiled validation plan: per column, the expected value kind and FK
+    // target, derived once from the PRAGMA results so per-field validation
+    // and relation resolution are hash lookups plus integer comparisons
+    // instead of string-compare ladders and FK list copies.
+    enum class ColumnKind : uint8_t { any, integer, real, text, blob };
+    struct ColumnPlan {
+        ColumnKind kind = ColumnKind::any;
+        std::string fk_target;  // empty when the column is not a foreign key
+    };
+
+    struct TableSchema {
+        std::vector<std::string> columns;
+        std::vector<ForeignKeyInfo> foreign_keys;
+        std::map<std::string, std::string> column_types;
+        std::unordered_map<std::string, ColumnPlan> validation_plan;
+    };
+    std::unordered_map<std::string, TableSchema> schema_cache;
+    std::unordered_map<std::string, std::vector<std::string>> table_list_cache;
+
+    void invalidate_schema_cache() {
+        schema_cache.clear();
+        table_list_cache.clear();
+        label_cache.clear();
+        clear_query_cache();
+    }
+
+    // Opt-in query result cache (see Database::set_query_cache). Entries
+    // are indexed by the tables their statements read (captured via the
+    // authorizer at prepare time) so writes invalidate precisely.
+    bool query_cache_enabled = false;
+    size_t query_cache_budget = 8 * 1024 * 1024;
+    size_t query_cache_bytes = 0;
+    struct CachedQuery {
+        Result result;
+        size_t bytes = 0;
+        std::set<std::string> tables;
+    };
+    std::list<std::pair<std::string, CachedQuery>> query_lru;
+    std::unordered_map<std::string, std::list<std::pair<std::string, CachedQuery>>::iterator> query_cache;
+    std::unordered_map<std::string, std::set<std::string>> query_keys_by_table;
+    std::set<std::string>* preparing_read_set = nullptr;
+
+    void drop_cached_query(const std::string& key) {
+        auto it = query_cache.find(key);
+        if (it == query_cache.end()) {
+            return;
+        }
+        query_cache_bytes -= it->second->second.bytes;
+        for (const auto& table : it->second->second.tables) {
+            query_keys_by_table[table].erase(key);
+        }
+        query_lru.erase(it->second);
+        query_cache.erase(it);
+    }
+
+    void invalidate_cached_queries(const std::string& table) {
+        auto it = query_keys_by_table.find(table);
+        if (it == query_keys_by_table.end()) {
+            return;
+        }
+        auto keys = it->second;  // drop_cached_query mutates the index
+        for (const auto& key : keys) {
+            drop_cached_query(key);
+        }
+    }
+
+    void clear_query_cache() {
+        query_lru.clear();
+        query_cache.clear();
+        query_keys_by_table.clear();
+        query_cache_bytes = 0;
+    }
+
+    // Query plan diagnostics (see Database::index_advisor_report)
+    std::atomic<bool> diagnostics_enabled{false};
+    struct PlanDiagnosis {
+        std::string table;   // scanned table (empty when the plan is fine)
+        std::string column;  // first filtered column, when identifiable
+        uint64_t occurrences = 0;
+    };
+    static constexpr size_t plan_diagnoses_capacity = 1024;
+    std::unordered_map<std::string, PlanDiagnosis> plan_diagnoses;
+
+    // Runs EXPLAIN QUERY PLAN on a freshly-prepared SQL shape and records
+    // whether it full-scans a table while filtering on a column. Bounded:
+    // workloads issuing endless distinct SQL strings stop being analysed
+    // once the map is full instead of growing without limit.
+    void diagnose_statement(const std::string& sql) {
+        if (plan_diagnoses.size() >= plan_diagnoses_capacity) {
+            return;
+        }
+
+        PlanDiagnosis diagnosis;
+        diagnosis.occurrences = 1;
+
+        sqlite3_stmt* stmt = nullptr;
+        std::string explain_sql = "EXPLAIN QUERY PLAN " + sql;
+        if (sqlite3_prepare_v2(db, explain_sql.c_str(), -1, &stmt, nullptr) == SQLITE_OK) {
+            while (sqlite3_step(stmt) == SQLITE_ROW) {
+                const char* detail = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
+                if (!detail) {
+                    continue;
+                }
+                std::string text = detail;
+                // "SCAN <table>" without a USING clause is a full table scan
+                if (text.compare(0, 5, "SCAN ") == 0 && text.find(" USING ") == std::string::npos) {
+                    auto columns = filtered_columns(sql);
+                    if (!columns.empty()) {
+                        diagnosis.table = text.substr(5);
+                        diagnosis.column = columns.front();
+                    }
+                    break;
+                }
+            }
+        }
+        sqlite3_finalize(stmt);
+
+        plan_diagnoses.emplace(sql, std::move(diagnosis));
+    }
+
+    // Opt-in label->id cache, one map per prefetched collection. Any write
+    // to a cached table drops its map (see update_hook below); negative
+    // lookups on a cached table can then be answered without a query.
+    std::unordered_map<std::string, std::unordered_map<std::string, int64_t>> label_cache;
+
+    // Change tracking ring (see Database::set_change_tracking). Guarded by
+    // its own mutex so poll_changes() never contends with statement
+    // execution beyond the hook itself.
+    std::atomic<bool> change_tracking{false};
+    size_t change_capacity = 4096;
+    std::deque<Change> change_ring;
+    std::set<std::string> change_filter;  // empty = all tables
+    std::function<void(const Change&)> change_callback;
+    std::mutex change_mutex;
+
+    static void update_hook(void* ctx, int op, const char* /*db_name*/, const char* table, sqlite3_int64 rowid) {
+        auto* impl = static_cast<Impl*>(ctx);
+        if (!table) {
+            return;
+        }
+
+        // The hook can fire without db_mutex held (a write stepped through
+        // a Cursor), while another thread reads the caches it mutates
+        std::lock_guard<std::recursive_mutex> lock(impl->db_mutex);
+
+        if (!impl->label_cache.empty()) {
+            impl->label_cache.erase(table);
+        }
+
+        if (impl->change_tracking.load(std::memory_order_relaxed)) {
+            impl->record_change(op, table, rowid);
+        }
+
+        if (impl->query_cache_enabled) {
+            impl->invalidate_cached_queries(table);
+        }
+    }
+
+    void record_change(int op, const char* table, sqlite3_int64 rowid) {
+        Change change;
+        change.table = table;
+        change.rowid = rowid;
+        switch (op) {
+        case SQLITE_INSERT:
+            change.op = Change::Op::insert;
+            break;
+        case SQLITE_UPDATE:
+            change.op = Change::Op::update;
+            break;
+        case SQLITE_DELETE:
+        default:
+            change.op = Change::Op::remove;
+            break;
+        }
+
+        std::function<void(const Change&)> callback;
+        {
+            std::lock_guard<std::mutex> lock(change_mutex);
+            if (!change_filter.empty() && change_filter.count(change.table) == 0) {
+                return;
+            }
+            if (change_ring.size() >= change_capacity) {
+                change_ring.pop_front();
+            }
+            change_ring.push_back(change);
+            callback = change_callback;
+        }
+        if (callback) {
+            callback(change);
+        }
+    }
+
+    // Returns a prepared statement for the given SQL, reusing a cached one
+    // when available. Cached statements are reset and cleared before reuse.
+    CachedStatement& acquire_statement(const std::string& sql) {
+        auto it = statement_cache.find(sql);
+        if (it != statement_cache.end()) {
+            ++statement_stats.hits;
+            if (diagnostics_enabled.load(std::memory_order_relaxed)) {
+                auto diag = plan_diagnoses.find(sql);
+                if (diag != plan_diagnoses.end()) {
+                    ++diag->second.occurrences;
+                }
+            }
+            statement_lru.splice(statement_lru.begin(), statement_lru, it->second);
+            sqlite3_reset(it->second->stmt);
+            sqlite3_clear_bindings(it->second->stmt);
+            return *it->second;
+        }
+
+        ++statement_stats.misses;
+
+        if (diagnostics_enabled.load(std::memory_order_relaxed) && plan_diagnoses.count(sql) == 0) {
+            diagnose_statement(sql);
+        }
+
+        auto start = stat_start();
+        std::set<std::string> read_set;
+        preparing_read_set = &read_set;
+        sqlite3_stmt* stmt = nullptr;
+        int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+        preparing_read_set = nullptr;
+        record_stat(op_stats.prepare, start);
+        if (rc != SQLITE_OK) {
+            throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(db)));
+        }
+
+        // Evict the least-recently-used statement if the cache is full
+        if (statement_lru.size() >= statement_cache_capacity) {
+            auto& lru = statement_lru.back();
+            sqlite3_finalize(lru.stmt);
+            statement_cache.erase(lru.sql);
+            statement_lru.pop_back();
+        }
+
+        statement_lru.push_front(CachedStatement{sql, stmt, std::move(read_set)});
+        statement_cache[sql] = statement_lru.begin();
+        return statement_lru.front();
+    }
+
+    void clear_statement_cache() {
+        for (auto& entry : statement_lru) {
+            sqlite3_finalize(entry.stmt);
+        }
+        statement_lru.clear();
+        statement_cache.clear();
+    }
+
+    // Serializes all statement execution on this connection. Recursive
+    // because transaction helpers execute statements of their own.
+    std::recursive_mutex db_mutex;
+
+    // Hot-path instrumentation. Disabled by default: each probe is a single
+    // relaxed atomic load; when enabled, latencies are folded into
+    // per-operation histograms under db_mutex.
+    std::atomic<bool> stats_enabled{false};
+    DatabaseStats op_stats;
+
+    using StatClock = std::chrono::steady_clock;
+
+    StatClock::time_point stat_start() const {
+        return stats_enabled.load(std::memory_order_relaxed) ? StatClock::now() : StatClock::time_point{};
+    }
+
+    void record_stat(DatabaseStats::Operation& op, StatClock::time_point start) {
+        if (start == StatClock::time_point{}) {
+            return;
+        }
+        auto us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(StatClock::now() - start).count());
+
+        std::lock_guard<std::recursive_mutex> lock(db_mutex);
+        ++op.count;
+        op.total_us += us;
+        op.max_us = std::max(op.max_us, us);
+
+        size_t bucket = 0;
+        while (bucket + 1 < op.histogram.size() && us >= (uint64_t(1) << bucket)) {
+            ++bucket;
+        }
+        ++op.histogram[bucket];
+    }
+
+    // Transaction guard nesting depth and group-commit state (see
+    // psr::Transaction). Counters tick in execute(); when a limit is hit
+    // with only the outermost guard active, the open transaction is
+    // committed and reopened.
+    int transaction_depth = 0;
+    uint64_t gc_op_limit = 0;
+    uint64_t gc_byte_limit = 0;
+    uint64_t gc_ops = 0;
+    uint64_t gc_bytes = 0;
+
+    void group_commit_tick(size_t bytes) {
+        if (gc_op_limit == 0 && gc_byte_limit == 0) {
+            return;
+        }
+        ++gc_ops;
+        gc_bytes += bytes;
+
+        bool over = (gc_op_limit > 0 && gc_ops >= gc_op_limit) || (gc_byte_limit > 0 && gc_bytes >= gc_byte_limit);
+        if (over && transaction_depth == 1 && sqlite3_get_autocommit(db) == 0) {
+            sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr);
+            sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr);
+            gc_ops = 0;
+            gc_bytes = 0;
+        }
+    }
+
+    // Tracks begin_transaction()/commit()/rollback() so the async pipeline
+    // can tell a user transaction apart from the writer's own batch
+    // transaction (sqlite3_get_autocommit cannot distinguish the two)
+    std::atomic<bool> user_transaction{false};
+
+    // Async write pipeline: submit() enqueues, a lazily-started writer
+    // thread drains the queue in grouped transactions.
+    struct PendingWrite {
+        std::string sql;
+        std::vector<Value> params;
+        size_t bytes = 0;
+    };
+    std::deque<PendingWrite> write_queue;
+    size_t queued_bytes = 0;
+    size_t write_budget = 16 * 1024 * 1024;  // backpressure threshold
+    bool writer_busy = false;
+    bool writer_stop = false;
+    std::string writer_error;
+    std::thread writer_thread;
+    std::mutex queue_mutex;
+    std::condition_variable queue_cv;    // signals the writer: work or stop
+    std::condition_variable space_cv;    // signals producers: budget freed
+    std::condition_variable drained_cv;  // signals flush(): queue drained
+
+    void writer_loop() {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        while (true) {
+            queue_cv.wait(lock, [this] { return writer_stop || !write_queue.empty(); });
+            if (write_queue.empty()) {
+                if (writer_stop) {
+                    return;
+                }
+                continue;
+            }
+
+            // Take the whole queue as one batch
+            std::deque<PendingWrite> batch;
+            batch.swap(write_queue);
+            queued_bytes = 0;
+            writer_busy = true;
+            lock.unlock();
+            space_cv.notify_all();
+
+            std::string error = run_write_batch(batch);
+
+            lock.lock();
+            writer_busy = false;
+            if (!error.empty() && writer_error.empty()) {
+                writer_error = std::move(error);
+            }
+            if (write_queue.empty()) {
+                drained_cv.notify_all();
+            }
+        }
+    }
+
+    // Executes one batch under the connection mutex in a single transaction.
+    // Returns an error message on failure (the batch rolls back as a unit).
+    std::string run_write_batch(std::deque<PendingWrite>& batch) {
+        std::unique_lock<std::recursive_mutex> db_lock(db_mutex);
+
+        // Respect a transaction the user has open: release the connection
+        // while waiting so the user can commit, then retry. Once we hold the
+        // mutex with no user transaction, none can start mid-batch.
+        while (user_transaction) {
+            db_lock.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            db_lock.lock();
+        }
+
+        if (sqlite3_exec(db, "BEGIN TRANSACTION", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            return std::string("Async write failed: ") + sqlite3_errmsg(db);
+        }
+
+        for (const auto& pending : batch) {
+            try {
+                sqlite3_stmt* stmt = acquire_statement(pending.sql).stmt;
+                bind_parameters(stmt, pending.params);
+                int rc = sqlite3_step(stmt);
+                sqlite3_reset(stmt);
+                if (rc != SQLITE_DONE && rc != SQLITE_ROW) {
+                    std::string error = std::string("Async write failed: ") + sqlite3_errmsg(db);
+                    sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+                    return error;
+                }
+            } catch (const std::exception& e) {
+                sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+                return e.what();
+            }
+        }
+
+        if (sqlite3_exec(db, "COMMIT", nullptr, nullptr, nullptr) != SQLITE_OK) {
+            std::string error = std::string("Async commit failed: ") + sqlite3_errmsg(db);
+            sqlite3_exec(db, "ROLLBACK", nullptr, nullptr, nullptr);
+            return error;
+        }
+        return {};
+    }
+
+    void stop_writer_thread() {
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            if (!writer_thread.joinable()) {
+                return;
+            }
+            writer_stop = true;
+        }
+        queue_cv.notify_all();
+        writer_thread.join();
+        writer_thread = std::thread();
+        writer_stop = false;
+    }
 
     ~Impl() {
+        stop_writer_thread();
         if (db) {
+            clear_statement_cache();
             sqlite3_close(db);
         }
     }
 };
 
-Database::Database(const std::string& path, LogLevel console_level) : impl_(std::make_unique<Impl>()) {
+Database::Database(const std::string& path, LogLevel console_level, Durability durability)
+    : Database(path, console_level, durability, false) {}
+
+Database::Database(const std::string& path, LogLevel console_level, Durability durability, bool read_only)
+    : impl_(std::make_unique<Impl>()) {
     impl_->path = path;
-    impl_->logger = create_database_logger(path, console_level);
+    impl_->console_level = console_level;
 
-    impl_->logger->debug("Opening database: {}", path);
+    impl_->log()->debug("Opening database: {}{}", path, read_only ? " (read-only)" : "");
 
-    int rc = sqlite3_open(path.c_str(), &impl_->db);
+    int flags = read_only ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
+    int rc = sqlite3_open_v2(path.c_str(), &impl_->db, flags, nullptr);
     if (rc != SQLITE_OK) {
         std::string error = sqlite3_errmsg(impl_->db);
-        impl_->logger->error("Failed to open database: {}", error);
+        impl_->log()->error("Failed to open database: {}", error);
         sqlite3_close(impl_->db);
         impl_->db = nullptr;
         throw std::runtime_error("Failed to open database: " + error);
@@ -117,7 +857,38 @@ Database::Database(const std::string& path, LogLevel console_level) : impl_(std:
 
     // Enable foreign keys
     sqlite3_exec(impl_->db, "PRAGMA foreign_keys = ON;", nullptr, nullptr, nullptr);
-    impl_->logger->debug("Database opened successfully, foreign keys enabled");
+
+    // Apply the connection performance profile one pragma at a time: a
+    // failing pragma (e.g. journal_mode on a read-only connection) must not
+    // abort the rest of the preset
+    for (const auto& pragma : connection_profile_pragmas(durability)) {
+        if (read_only && pragma.requires_write) {
+            continue;
+        }
+        if (sqlite3_exec(impl_->db, pragma.sql, nullptr, nullptr, nullptr) != SQLITE_OK) {
+            impl_->log()->warn("Profile pragma failed: {} ({})", pragma.sql, sqlite3_errmsg(impl_->db));
+        }
+    }
+
+    // Invalidate the label cache when a cached table is written. The no-op
+    // authorizer disables SQLite's truncate optimization so DELETE without
+    // WHERE still fires the hook for every row (otherwise the label cache
+    // and change journal would miss full-table deletes).
+    sqlite3_update_hook(impl_->db, &Impl::update_hook, impl_.get());
+    // (Returning SQLITE_IGNORE for SQLITE_DELETE does not block deletes;
+    // it is SQLite's documented switch for forcing row-by-row deletion.)
+    sqlite3_set_authorizer(
+        impl_->db,
+        [](void* ctx, int action, const char* arg1, const char*, const char*, const char*) {
+            auto* impl = static_cast<Impl*>(ctx);
+            if (action == SQLITE_READ && impl->preparing_read_set && arg1) {
+                impl->preparing_read_set->insert(arg1);
+            }
+            return action == SQLITE_DELETE ? SQLITE_IGNORE : SQLITE_OK;
+        },
+        impl_.get());
+
+    impl_->log()->debug("Database opened successfully, foreign keys enabled");
 }
 
 Database::~Database() = default;
@@ -132,6 +903,8 @@ bool Database::is_open() const {
 
 void Database::close() {
     if (impl_ && impl_->db) {
+        impl_->stop_writer_thread();
+        impl_->clear_statement_cache();
         sqlite3_close(impl_->db);
         impl_->db = nullptr;
     }
@@ -146,86 +919,259 @@ Result Database::execute(const std::string& sql, const std::vector<Value>& param
         throw std::runtime_error("Database is not open");
     }
 
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    // The query cache is bypassed inside a transaction in both directions:
+    // results seen there may be rolled back (never cache them), and cached
+    // pre-transaction results must not shadow uncommitted writes
+    bool cacheable_context = impl_->query_cache_enabled && sqlite3_get_autocommit(impl_->db) != 0;
+
+    std::string cache_key;
+    if (cacheable_context) {
+        cache_key = query_cache_key(sql, params);
+        auto hit = impl_->query_cache.find(cache_key);
+        if (hit != impl_->query_cache.end()) {
+            ++impl_->op_stats.query_cache_hits;
+            impl_->query_lru.splice(impl_->query_lru.begin(), impl_->query_lru, hit->second);
+            return hit->second->second.result;
+        }
+    }
+
+    auto& cached_stmt = impl_->acquire_statement(sql);
+    sqlite3_stmt* stmt = cached_stmt.stmt;
+    int rc;
+
+    auto bind_start = impl_->stat_start();
+    bind_parameters(stmt, params);
+    impl_->record_stat(impl_->op_stats.bind, bind_start);
+
+    // Get column info
+    std::vector<std::string> columns;
+    int col_count = sqlite3_column_count(stmt);
+    columns.reserve(col_count);
+    for (int i = 0; i < col_count; ++i) {
+        const char* name = sqlite3_column_name(stmt, i);
+        columns.emplace_back(name ? name : "");
+    }
+
+    // Execute and fetch results into one flat cell buffer (row i's cells at
+    // [i * col_count, ...)); the Result's rows are views into it, so no
+    // per-row vector is allocated
+    auto step_start = impl_->stat_start();
+    std::vector<Value> cells;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        for (int i = 0; i < col_count; ++i) {
+            int type = sqlite3_column_type(stmt, i);
+            switch (type) {
+            case SQLITE_INTEGER:
+                cells.emplace_back(sqlite3_column_int64(stmt, i));
+                break;
+            case SQLITE_FLOAT:
+                cells.emplace_back(sqlite3_column_double(stmt, i));
+                break;
+            case SQLITE_TEXT: {
+                const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, i));
+                cells.emplace_back(std::string(text ? text : ""));
+                break;
+            }
+            case SQLITE_BLOB: {
+                const uint8_t* data = reinterpret_cast<const uint8_t*>(sqlite3_column_blob(stmt, i));
+                int size = sqlite3_column_bytes(stmt, i);
+                cells.emplace_back(std::vector<uint8_t>(data, data + size));
+                break;
+            }
+            case SQLITE_NULL:
+            default:
+                cells.emplace_back(nullptr);
+                break;
+            }
+        }
+    }
+
+    impl_->record_stat(impl_->op_stats.step, step_start);
+
+    // Reset instead of finalize so the cached statement releases its locks
+    // and can be reused by the next execute() of the same SQL; clear the
+    // bindings so it does not keep SQLITE_STATIC pointers into the caller's
+    // (now out-of-scope) parameters
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+
+    // DDL may have changed the schema out from under the metadata cache
+    if (is_ddl_statement(sql)) {
+        impl_->invalidate_schema_cache();
+    }
+
+    // Group-commit accounting for an active Transaction guard
+    size_t param_bytes = sql.size();
+    for (const auto& param : params) {
+        if (const auto* str = std::get_if<std::string>(&param)) {
+            param_bytes += str->size();
+        } else if (const auto* blob = std::get_if<std::vector<uint8_t>>(&param)) {
+            param_bytes += blob->size();
+        } else {
+            param_bytes += sizeof(Value);
+        }
+    }
+    impl_->group_commit_tick(param_bytes);
+
+    Result result(std::move(columns), std::move(cells));
+
+    // Cache read-only statements, evicting least-recently-used entries
+    // once over budget
+    if (cacheable_context && sqlite3_stmt_readonly(stmt)) {
+        ++impl_->op_stats.query_cache_misses;
+
+        Impl::CachedQuery entry;
+        entry.result = result;
+        entry.bytes = cache_key.size() + estimate_result_bytes(result);
+        entry.tables = cached_stmt.read_set;
+
+        if (entry.bytes <= impl_->query_cache_budget) {
+            impl_->drop_cached_query(cache_key);
+            impl_->query_cache_bytes += entry.bytes;
+            for (const auto& table : entry.tables) {
+                impl_->query_keys_by_table[table].insert(cache_key);
+            }
+            impl_->query_lru.emplace_front(cache_key, std::move(entry));
+            impl_->query_cache[cache_key] = impl_->query_lru.begin();
+
+            while (impl_->query_cache_bytes > impl_->query_cache_budget && !impl_->query_lru.empty()) {
+                impl_->drop_cached_query(impl_->query_lru.back().first);
+            }
+        }
+    }
+
+    return result;
+}
+
+Cursor Database::query(const std::string& sql) {
+    return query(sql, {});
+}
+
+Cursor Database::query(const std::string& sql, const std::vector<Value>& params) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    // The cursor owns its statement for the duration of the iteration, so it
+    // is prepared outside the statement cache
     sqlite3_stmt* stmt = nullptr;
     int rc = sqlite3_prepare_v2(impl_->db, sql.c_str(), -1, &stmt, nullptr);
     if (rc != SQLITE_OK) {
         throw std::runtime_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(impl_->db)));
     }
 
-    // Bind parameters
-    for (size_t i = 0; i < params.size(); ++i) {
-        int idx = static_cast<int>(i + 1);
-        const auto& param = params[i];
+    // The cursor steps after this call returns, so the params must be
+    // copied into the statement rather than referenced in place
+    bind_parameters(stmt, params, SQLITE_TRANSIENT);
 
-        std::visit(
-            [&](auto&& arg) {
-                using T = std::decay_t<decltype(arg)>;
-                if constexpr (std::is_same_v<T, std::nullptr_t>) {
-                    sqlite3_bind_null(stmt, idx);
-                } else if constexpr (std::is_same_v<T, int64_t>) {
-                    sqlite3_bind_int64(stmt, idx, arg);
-                } else if constexpr (std::is_same_v<T, double>) {
-                    sqlite3_bind_double(stmt, idx, arg);
-                } else if constexpr (std::is_same_v<T, std::string>) {
-                    sqlite3_bind_text(stmt, idx, arg.c_str(), static_cast<int>(arg.size()), SQLITE_TRANSIENT);
-                } else if constexpr (std::is_same_v<T, std::vector<uint8_t>>) {
-                    sqlite3_bind_blob(stmt, idx, arg.data(), static_cast<int>(arg.size()), SQLITE_TRANSIENT);
-                }
-            },
-            param);
+    // Conservatively assume DDL run through a cursor will change the schema
+    if (is_ddl_statement(sql)) {
+        impl_->invalidate_schema_cache();
     }
 
-    // Get column info
-    std::vector<std::string> columns;
+    return Cursor(impl_->db, stmt, &impl_->db_mutex);
+}
+
+ColumnarResult Database::execute_columnar(const std::string& sql) {
+    return execute_columnar(sql, {});
+}
+
+ColumnarResult Database::execute_columnar(const std::string& sql, const std::vector<Value>& params) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    sqlite3_stmt* stmt = impl_->acquire_statement(sql).stmt;
+    bind_parameters(stmt, params);
+
     int col_count = sqlite3_column_count(stmt);
+    std::vector<std::string> columns;
     columns.reserve(col_count);
     for (int i = 0; i < col_count; ++i) {
         const char* name = sqlite3_column_name(stmt, i);
         columns.emplace_back(name ? name : "");
     }
 
-    // Execute and fetch results
-    std::vector<Row> rows;
+    ColumnarResult result;
+    result.set_columns(std::move(columns));
+
+    int rc;
     while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-        std::vector<Value> values;
-        values.reserve(col_count);
-
         for (int i = 0; i < col_count; ++i) {
+            size_t col = static_cast<size_t>(i);
             int type = sqlite3_column_type(stmt, i);
-            switch (type) {
-            case SQLITE_INTEGER:
-                values.emplace_back(sqlite3_column_int64(stmt, i));
+
+            if (type == SQLITE_NULL) {
+                result.append_null(col);
+                continue;
+            }
+
+            // First non-null value fixes the column's type; later values
+            // are coerced to it by SQLite's column conversions
+            if (result.column_type(col) == ColumnarResult::ColumnType::null) {
+                switch (type) {
+                case SQLITE_INTEGER:
+                    result.decide_type(col, ColumnarResult::ColumnType::integer);
+                    break;
+                case SQLITE_FLOAT:
+                    result.decide_type(col, ColumnarResult::ColumnType::real);
+                    break;
+                case SQLITE_TEXT:
+                    result.decide_type(col, ColumnarResult::ColumnType::text);
+                    break;
+                case SQLITE_BLOB:
+                default:
+                    result.decide_type(col, ColumnarResult::ColumnType::blob);
+                    break;
+                }
+            }
+
+            switch (result.column_type(col)) {
+            case ColumnarResult::ColumnType::integer:
+                result.append_int(col, sqlite3_column_int64(stmt, i));
                 break;
-            case SQLITE_FLOAT:
-                values.emplace_back(sqlite3_column_double(stmt, i));
+            case ColumnarResult::ColumnType::real:
+                result.append_double(col, sqlite3_column_double(stmt, i));
                 break;
-            case SQLITE_TEXT: {
+            case ColumnarResult::ColumnType::text: {
                 const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, i));
-                values.emplace_back(std::string(text ? text : ""));
+                result.append_bytes(col, text ? text : "", static_cast<size_t>(sqlite3_column_bytes(stmt, i)));
                 break;
             }
-            case SQLITE_BLOB: {
-                const uint8_t* data = reinterpret_cast<const uint8_t*>(sqlite3_column_blob(stmt, i));
-                int size = sqlite3_column_bytes(stmt, i);
-                values.emplace_back(std::vector<uint8_t>(data, data + size));
+            case ColumnarResult::ColumnType::blob: {
+                const char* data = static_cast<const char*>(sqlite3_column_blob(stmt, i));
+                result.append_bytes(col, data ? data : "", static_cast<size_t>(sqlite3_column_bytes(stmt, i)));
                 break;
             }
-            case SQLITE_NULL:
-            default:
-                values.emplace_back(nullptr);
+            case ColumnarResult::ColumnType::null:
                 break;
             }
         }
-        rows.emplace_back(std::move(values));
+        result.finish_row();
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
 
     if (rc != SQLITE_DONE) {
         throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
     }
 
-    return Result(std::move(columns), std::move(rows));
+    return result;
+}
+
+Database Database::open_read_only(const std::string& path, LogLevel console_level, Durability durability) {
+    return Database(path, console_level, durability, true);
 }
 
 int64_t Database::last_insert_rowid() const {
@@ -242,16 +1188,98 @@ int Database::changes() const {
     return sqlite3_changes(impl_->db);
 }
 
+void Database::submit(const std::string& sql) {
+    submit(sql, {});
+}
+
+void Database::submit(const std::string& sql, const std::vector<Value>& params) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    // Same precondition as flush(): inside a user transaction the writer
+    // defers and can never drain, so a full queue would block this thread
+    // forever while it still owns the commit
+    if (impl_->user_transaction) {
+        throw std::runtime_error("submit() cannot be called inside a transaction");
+    }
+
+    Impl::PendingWrite pending;
+    pending.bytes = sql.size() + sizeof(Impl::PendingWrite);
+    for (const auto& param : params) {
+        if (const auto* str = std::get_if<std::string>(&param)) {
+            pending.bytes += str->size();
+        } else if (const auto* blob = std::get_if<std::vector<uint8_t>>(&param)) {
+            pending.bytes += blob->size();
+        } else {
+            pending.bytes += sizeof(Value);
+        }
+    }
+    pending.sql = sql;
+    pending.params = params;
+
+    std::unique_lock<std::mutex> lock(impl_->queue_mutex);
+
+    // Lazily start the writer thread on first use
+    if (!impl_->writer_thread.joinable()) {
+        impl_->writer_thread = std::thread([impl = impl_.get()] { impl->writer_loop(); });
+    }
+
+    // Backpressure: block while the queue is over budget
+    impl_->space_cv.wait(lock, [this] { return impl_->queued_bytes < impl_->write_budget; });
+
+    impl_->queued_bytes += pending.bytes;
+    impl_->write_queue.push_back(std::move(pending));
+    lock.unlock();
+    impl_->queue_cv.notify_one();
+}
+
+void Database::flush() {
+    if (!impl_) {
+        return;
+    }
+
+    if (impl_->user_transaction) {
+        throw std::runtime_error("flush() cannot be called inside a transaction");
+    }
+
+    std::unique_lock<std::mutex> lock(impl_->queue_mutex);
+    impl_->drained_cv.wait(lock, [this] { return impl_->write_queue.empty() && !impl_->writer_busy; });
+
+    if (!impl_->writer_error.empty()) {
+        std::string error;
+        error.swap(impl_->writer_error);
+        throw std::runtime_error(error);
+    }
+}
+
+void Database::set_async_write_budget(size_t bytes) {
+    std::lock_guard<std::mutex> lock(impl_->queue_mutex);
+    impl_->write_budget = bytes;
+    impl_->space_cv.notify_all();
+}
+
 void Database::begin_transaction() {
+    // Hold the connection across statement and flag update so the async
+    // writer never observes BEGIN-without-flag (it would try to open its
+    // own transaction inside ours)
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
     execute("BEGIN TRANSACTION");
+    impl_->user_transaction = true;
 }
 
 void Database::commit() {
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+    auto start = impl_->stat_start();
     execute("COMMIT");
+    impl_->record_stat(impl_->op_stats.commit, start);
+    impl_->user_transaction = false;
 }
 
 void Database::rollback() {
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
     execute("ROLLBACK");
+    impl_->user_transaction = false;
 }
 
 const std::string& Database::path() const {
@@ -265,25 +1293,94 @@ std::string Database::error_message() const {
     return sqlite3_errmsg(impl_->db);
 }
 
+void Database::set_stats_enabled(bool enabled) {
+    impl_->stats_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Database::stats_enabled() const {
+    return impl_ && impl_->stats_enabled.load(std::memory_order_relaxed);
+}
+
+DatabaseStats Database::stats() const {
+    if (!impl_) {
+        return {};
+    }
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+    return impl_->op_stats;
+}
+
+void Database::reset_stats() {
+    if (impl_) {
+        std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+        impl_->op_stats = {};
+    }
+}
+
+void Database::set_query_cache(bool enabled, size_t byte_budget) {
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+    impl_->query_cache_enabled = enabled;
+    impl_->query_cache_budget = byte_budget;
+    if (!enabled) {
+        impl_->clear_query_cache();
+    }
+}
+
+void Database::set_diagnostics_enabled(bool enabled) {
+    impl_->diagnostics_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+std::vector<Database::IndexAdvice> Database::index_advisor_report() const {
+    std::vector<IndexAdvice> report;
+    if (!impl_) {
+        return report;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+    for (const auto& [sql, diagnosis] : impl_->plan_diagnoses) {
+        if (!diagnosis.table.empty()) {
+            report.push_back({diagnosis.table, diagnosis.column, sql, diagnosis.occurrences});
+        }
+    }
+
+    std::sort(report.begin(), report.end(),
+              [](const IndexAdvice& a, const IndexAdvice& b) { return a.occurrences > b.occurrences; });
+    return report;
+}
+
+Database::StatementCacheStats Database::statement_cache_stats() const {
+    if (!impl_) {
+        return {};
+    }
+    return impl_->statement_stats;
+}
+
+void Database::clear_statement_cache() {
+    if (impl_) {
+        std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+        impl_->clear_statement_cache();
+    }
+}
+
 Database Database::from_schema(const std::string& database_path, const std::string& schema_path,
-                               LogLevel console_level) {
-    // Validate schema path before creating database
+                               LogLevel console_level, Durability durability) {
+    // Validate schema path before creating database (a directory of
+    // numbered migrations, or a packed bundle file)
     if (!std::filesystem::exists(schema_path)) {
         throw std::runtime_error("Schema path does not exist: " + schema_path);
     }
-    if (!std::filesystem::is_directory(schema_path)) {
-        throw std::runtime_error("Schema path is not a directory: " + schema_path);
+    if (!std::filesystem::is_directory(schema_path) && !std::filesystem::is_regular_file(schema_path)) {
+        throw std::runtime_error("Schema path is not a directory or bundle file: " + schema_path);
     }
 
-    Database db(database_path, console_level);
+    Database db(database_path, console_level, durability);
     db.impl_->schema_path = schema_path;
 
-    db.impl_->logger->info("Opening database from schema: db={}, schema={}", database_path, schema_path);
-    db.impl_->logger->debug("Database opened, current version: {}", db.current_version());
+    db.impl_->log()->info("Opening database from schema: db={}, schema={}", database_path, schema_path);
+    db.impl_->log()->debug("Database opened, current version: {}", db.current_version());
 
     db.migrate_up();
 
-    db.impl_->logger->info("Database ready, version: {}", db.current_version());
+    db.impl_->log()->info("Database ready, version: {}", db.current_version());
     return db;
 }
 
@@ -315,12 +1412,43 @@ void Database::migrate_up() {
     }
 
     if (impl_->schema_path.empty()) {
-        impl_->logger->debug("No schema path set, skipping migrations");
+        impl_->log()->debug("No schema path set, skipping migrations");
         return;
     }
 
     namespace fs = std::filesystem;
 
+    // Bundle fast path: all pending migrations in one transaction, one fsync
+    if (fs::is_regular_file(impl_->schema_path)) {
+        auto migrations = read_migration_bundle(impl_->schema_path);
+        std::sort(migrations.begin(), migrations.end());
+
+        int64_t current = current_version();
+        impl_->log()->debug("Bundle has {} migrations, current version: {}", migrations.size(), current);
+
+        auto start = impl_->stat_start();
+        begin_transaction();
+        int64_t applied = current;
+        try {
+            for (const auto& [version, sql] : migrations) {
+                if (version <= current) {
+                    continue;
+                }
+                impl_->log()->info("Applying migration {} (bundled)", version);
+                execute_script(sql);
+                applied = version;
+            }
+            set_version(applied);
+            commit();
+            impl_->record_stat(impl_->op_stats.migration, start);
+        } catch (const std::exception& e) {
+            rollback();
+            impl_->log()->error("Bundled migration failed: {}", e.what());
+            throw std::runtime_error("Bundled migration failed: " + std::string(e.what()));
+        }
+        return;
+    }
+
     // Collect all numbered migration directories
     std::vector<int64_t> versions;
     for (const auto& entry : fs::directory_iterator(impl_->schema_path)) {
@@ -344,7 +1472,7 @@ void Database::migrate_up() {
     std::sort(versions.begin(), versions.end());
 
     int64_t current = current_version();
-    impl_->logger->debug("Found {} migrations, current version: {}", versions.size(), current);
+    impl_->log()->debug("Found {} migrations, current version: {}", versions.size(), current);
 
     // Apply each pending migration
     for (int64_t version : versions) {
@@ -356,14 +1484,14 @@ void Database::migrate_up() {
         fs::path up_sql_path = migration_dir / "up.sql";
 
         if (!fs::exists(up_sql_path)) {
-            impl_->logger->error("Migration file not found: {}", up_sql_path.string());
+            impl_->log()->error("Migration file not found: {}", up_sql_path.string());
             throw std::runtime_error("Migration file not found: " + up_sql_path.string());
         }
 
         // Read the SQL file
         std::ifstream file(up_sql_path);
         if (!file) {
-            impl_->logger->error("Failed to open migration file: {}", up_sql_path.string());
+            impl_->log()->error("Failed to open migration file: {}", up_sql_path.string());
             throw std::runtime_error("Failed to open migration file: " + up_sql_path.string());
         }
 
@@ -372,21 +1500,111 @@ void Database::migrate_up() {
         std::string sql = buffer.str();
 
         // Apply migration in a transaction
-        impl_->logger->info("Applying migration {}", version);
+        impl_->log()->info("Applying migration {}", version);
+        auto start = impl_->stat_start();
         begin_transaction();
         try {
-            execute(sql);
+            execute_script(sql);
             set_version(version);
             commit();
-            impl_->logger->debug("Migration {} applied successfully", version);
+            impl_->invalidate_schema_cache();
+            impl_->record_stat(impl_->op_stats.migration, start);
+            impl_->log()->debug("Migration {} applied successfully", version);
         } catch (const std::exception& e) {
             rollback();
-            impl_->logger->error("Migration {} failed: {}", version, e.what());
+            impl_->log()->error("Migration {} failed: {}", version, e.what());
             throw std::runtime_error("Migration " + std::to_string(version) + " failed: " + e.what());
         }
     }
 }
 
+// Runs a migration script with sqlite3_exec, which - unlike execute() -
+// applies every statement in a multi-statement script
+void Database::execute_script(const std::string& sql) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    char* errmsg = nullptr;
+    int rc = sqlite3_exec(impl_->db, sql.c_str(), nullptr, nullptr, &errmsg);
+    if (rc != SQLITE_OK) {
+        std::string error = errmsg ? errmsg : sqlite3_errmsg(impl_->db);
+        sqlite3_free(errmsg);
+        throw std::runtime_error("Failed to execute statement: " + error);
+    }
+
+    impl_->invalidate_schema_cache();
+}
+
+void Database::pack_migrations(const std::string& schema_path, const std::string& bundle_path) {
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(schema_path)) {
+        throw std::runtime_error("Schema path is not a directory: " + schema_path);
+    }
+
+    std::vector<int64_t> versions;
+    for (const auto& entry : fs::directory_iterator(schema_path)) {
+        if (!entry.is_directory()) {
+            continue;
+        }
+        const auto& dirname = entry.path().filename().string();
+        try {
+            size_t pos = 0;
+            int64_t version = std::stoll(dirname, &pos);
+            if (pos == dirname.size() && version > 0) {
+                versions.push_back(version);
+            }
+        } catch (const std::exception&) {
+            // Not a numeric directory name, skip
+        }
+    }
+    std::sort(versions.begin(), versions.end());
+
+    std::ofstream out(bundle_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Failed to create migration bundle: " + bundle_path);
+    }
+    out << migration_bundle_magic << "\n";
+
+    for (int64_t version : versions) {
+        fs::path up_sql_path = fs::path(schema_path) / std::to_string(version) / "up.sql";
+        std::ifstream file(up_sql_path);
+        if (!file) {
+            throw std::runtime_error("Migration file not found: " + up_sql_path.string());
+        }
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        std::string sql = buffer.str();
+
+        out << version << " " << sql.size() << "\n" << sql << "\n";
+    }
+
+    if (!out) {
+        throw std::runtime_error("Failed to write migration bundle: " + bundle_path);
+    }
+}
+
+Database Database::from_template(const std::string& database_path, const std::string& template_path,
+                                 LogLevel console_level, Durability durability) {
+    namespace fs = std::filesystem;
+
+    if (!fs::is_regular_file(template_path)) {
+        throw std::runtime_error("Template database does not exist: " + template_path);
+    }
+
+    // Clone only into a missing or empty target; an existing database with
+    // content is opened as-is
+    bool clone = !fs::exists(database_path) || fs::file_size(database_path) == 0;
+    if (clone) {
+        fs::copy_file(template_path, database_path, fs::copy_options::overwrite_existing);
+    }
+
+    return Database(database_path, console_level, durability);
+}
+
 const std::string& Database::schema_path() const {
     return impl_->schema_path;
 }
@@ -454,12 +1672,16 @@ psr::Value get_vector_element(const psr::Value& v, size_t index) {
 
 // Schema introspection methods
 
-std::vector<std::string> Database::get_vector_tables(const std::string& collection) const {
+std::vector<std::string> Database::get_tables_with_prefix(const std::string& prefix) const {
     if (!is_open()) {
         return {};
     }
 
-    std::string prefix = collection + "_vector_";
+    auto it = impl_->table_list_cache.find(prefix);
+    if (it != impl_->table_list_cache.end()) {
+        return it->second;
+    }
+
     auto result = const_cast<Database*>(this)->execute(
         "SELECT name FROM sqlite_master WHERE type='table' AND name LIKE ?", {prefix + "%"});
 
@@ -470,45 +1692,77 @@ std::vector<std::string> Database::get_vector_tables(const std::string& collecti
             tables.push_back(*name);
         }
     }
+
+    impl_->table_list_cache.emplace(prefix, tables);
     return tables;
 }
 
-std::vector<std::string> Database::get_set_tables(const std::string& collection) const {
-    if (!is_open()) {
-        return {};
+// Populates the schema cache entry for a table (one PRAGMA table_info and
+// one PRAGMA foreign_key_list round-trip, then served from memory)
+void Database::ensure_table_schema(const std::string& table) const {
+    if (impl_->schema_cache.count(table) > 0) {
+        return;
     }
 
-    std::string prefix = collection + "_set_";
-    auto result = const_cast<Database*>(this)->execute(
-        "SELECT name FROM sqlite_master WHERE type='table' AND name LIKE ?", {prefix + "%"});
+    auto start = impl_->stat_start();
 
-    std::vector<std::string> tables;
-    for (const auto& row : result) {
-        auto name = row.get_string(0);
+    Impl::TableSchema schema;
+
+    auto info = const_cast<Database*>(this)->execute("PRAGMA table_info(\"" + table + "\")");
+    for (const auto& row : info) {
+        auto name = row.get_string(1);  // Column name is at index 1
         if (name) {
-            tables.push_back(*name);
+            schema.columns.push_back(*name);
+            schema.column_types[*name] = row.get_string(2).value_or("");  // type is at index 2
         }
     }
-    return tables;
-}
 
-std::vector<std::string> Database::get_time_series_tables(const std::string& collection) const {
-    if (!is_open()) {
-        return {};
+    auto fk_list = const_cast<Database*>(this)->execute("PRAGMA foreign_key_list(\"" + table + "\")");
+    for (const auto& row : fk_list) {
+        ForeignKeyInfo fk;
+        fk.target_table = row.get_string(2).value_or("");   // table
+        fk.column = row.get_string(3).value_or("");         // from
+        fk.target_column = row.get_string(4).value_or("");  // to
+        if (!fk.column.empty()) {
+            schema.foreign_keys.push_back(fk);
+        }
     }
 
-    std::string prefix = collection + "_time_series_";
-    auto result = const_cast<Database*>(this)->execute(
-        "SELECT name FROM sqlite_master WHERE type='table' AND name LIKE ?", {prefix + "%"});
-
-    std::vector<std::string> tables;
-    for (const auto& row : result) {
-        auto name = row.get_string(0);
-        if (name) {
-            tables.push_back(*name);
+    // Compile the validation plan from the introspection results
+    for (const auto& [name, type] : schema.column_types) {
+        Impl::ColumnPlan plan;
+        if (type == "INTEGER") {
+            plan.kind = Impl::ColumnKind::integer;
+        } else if (type == "REAL") {
+            plan.kind = Impl::ColumnKind::real;
+        } else if (type == "TEXT") {
+            plan.kind = Impl::ColumnKind::text;
+        } else if (type == "BLOB") {
+            plan.kind = Impl::ColumnKind::blob;
         }
+        schema.validation_plan.emplace(name, std::move(plan));
     }
-    return tables;
+    for (const auto& fk : schema.foreign_keys) {
+        auto it = schema.validation_plan.find(fk.column);
+        if (it != schema.validation_plan.end()) {
+            it->second.fk_target = fk.target_table;
+        }
+    }
+
+    impl_->schema_cache.emplace(table, std::move(schema));
+    impl_->record_stat(impl_->op_stats.introspection, start);
+}
+
+std::vector<std::string> Database::get_vector_tables(const std::string& collection) const {
+    return get_tables_with_prefix(collection + "_vector_");
+}
+
+std::vector<std::string> Database::get_set_tables(const std::string& collection) const {
+    return get_tables_with_prefix(collection + "_set_");
+}
+
+std::vector<std::string> Database::get_time_series_tables(const std::string& collection) const {
+    return get_tables_with_prefix(collection + "_time_series_");
 }
 
 std::vector<std::string> Database::get_table_columns(const std::string& table) const {
@@ -516,16 +1770,8 @@ std::vector<std::string> Database::get_table_columns(const std::string& table) c
         return {};
     }
 
-    auto result = const_cast<Database*>(this)->execute("PRAGMA table_info(\"" + table + "\")");
-
-    std::vector<std::string> columns;
-    for (const auto& row : result) {
-        auto name = row.get_string(1);  // Column name is at index 1
-        if (name) {
-            columns.push_back(*name);
-        }
-    }
-    return columns;
+    ensure_table_schema(table);
+    return impl_->schema_cache[table].columns;
 }
 
 std::vector<Database::ForeignKeyInfo> Database::get_foreign_keys(const std::string& table) const {
@@ -533,19 +1779,8 @@ std::vector<Database::ForeignKeyInfo> Database::get_foreign_keys(const std::stri
         return {};
     }
 
-    auto result = const_cast<Database*>(this)->execute("PRAGMA foreign_key_list(\"" + table + "\")");
-
-    std::vector<ForeignKeyInfo> fks;
-    for (const auto& row : result) {
-        ForeignKeyInfo fk;
-        fk.target_table = row.get_string(2).value_or("");   // table
-        fk.column = row.get_string(3).value_or("");         // from
-        fk.target_column = row.get_string(4).value_or("");  // to
-        if (!fk.column.empty()) {
-            fks.push_back(fk);
-        }
-    }
-    return fks;
+    ensure_table_schema(table);
+    return impl_->schema_cache[table].foreign_keys;
 }
 
 std::string Database::get_column_type(const std::string& table, const std::string& column) const {
@@ -553,114 +1788,169 @@ std::string Database::get_column_type(const std::string& table, const std::strin
         return "";
     }
 
-    auto result = const_cast<Database*>(this)->execute("PRAGMA table_info(\"" + table + "\")");
-
-    for (const auto& row : result) {
-        auto col_name = row.get_string(1);  // name is at index 1
-        if (col_name && *col_name == column) {
-            return row.get_string(2).value_or("");  // type is at index 2
-        }
-    }
-    return "";
+    ensure_table_schema(table);
+    const auto& types = impl_->schema_cache[table].column_types;
+    auto it = types.find(column);
+    return it != types.end() ? it->second : "";
 }
 
 void Database::validate_value_type(const std::string& table, const std::string& column, const Value& value) {
-    std::string col_type = get_column_type(table, column);
-    if (col_type.empty()) {
-        return;  // Column not found, let SQLite handle it
+    if (!is_open()) {
+        return;
     }
 
-    // Skip validation for foreign key columns - they accept string labels that get resolved to IDs
-    auto fks = get_foreign_keys(table);
-    for (const auto& fk : fks) {
-        if (fk.column == column) {
-            return;  // This is a FK column, skip type validation
-        }
+    ensure_table_schema(table);
+    const auto& schema = impl_->schema_cache[table];
+
+    auto it = schema.validation_plan.find(column);
+    if (it == schema.validation_plan.end()) {
+        return;  // Column not found, let SQLite handle it
     }
 
-    // Null is always valid
-    if (std::holds_alternative<std::nullptr_t>(value)) {
+    const auto& plan = it->second;
+
+    // FK columns accept string labels that get resolved to IDs
+    if (!plan.fk_target.empty()) {
         return;
     }
 
-    bool valid = true;
-    std::string actual_type;
+    // Null is always valid; untyped columns accept anything
+    if (plan.kind == Impl::ColumnKind::any || std::holds_alternative<std::nullptr_t>(value)) {
+        return;
+    }
 
+    bool valid;
+    const char* actual_type;
     if (std::holds_alternative<int64_t>(value)) {
         actual_type = "INTEGER";
+        valid = plan.kind == Impl::ColumnKind::integer || plan.kind == Impl::ColumnKind::real;
     } else if (std::holds_alternative<double>(value)) {
         actual_type = "REAL";
+        valid = plan.kind == Impl::ColumnKind::real;
     } else if (std::holds_alternative<std::string>(value)) {
         actual_type = "TEXT";
+        valid = plan.kind == Impl::ColumnKind::text;
     } else if (std::holds_alternative<std::vector<uint8_t>>(value)) {
         actual_type = "BLOB";
+        valid = plan.kind == Impl::ColumnKind::blob;
     } else {
         return;  // Vector types are handled separately
     }
 
-    // Check type compatibility
-    if (col_type == "TEXT") {
-        valid = (actual_type == "TEXT");
-    } else if (col_type == "INTEGER") {
-        valid = (actual_type == "INTEGER");
-    } else if (col_type == "REAL") {
-        valid = (actual_type == "REAL" || actual_type == "INTEGER");  // INTEGER can be REAL
-    } else if (col_type == "BLOB") {
-        valid = (actual_type == "BLOB");
+    if (!valid) {
+        throw std::runtime_error("Type mismatch for column '" + column + "': expected " +
+                                 schema.column_types.at(column) + " but got " + actual_type);
+    }
+}
+
+int64_t Database::get_element_id(const std::string& collection, const std::string& label) const {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    // Serve from the prefetched label map when available; a cached table is
+    // authoritative until a write drops it, so misses are real absences.
+    // Locked: the update hook erases entries from the async writer thread.
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+    auto cached = impl_->label_cache.find(collection);
+    if (cached != impl_->label_cache.end()) {
+        auto it = cached->second.find(label);
+        if (it != cached->second.end()) {
+            return it->second;
+        }
+        throw std::runtime_error("Element not found: " + label + " in " + collection);
+    }
+
+    auto result =
+        const_cast<Database*>(this)->execute("SELECT id FROM \"" + collection + "\" WHERE label = ?", {label});
+
+    if (result.empty()) {
+        throw std::runtime_error("Element not found: " + label + " in " + collection);
+    }
+
+    auto id = result[0].get_int(0);
+    if (!id) {
+        throw std::runtime_error("Invalid ID for element: " + label);
+    }
+    return *id;
+}
+
+void Database::set_change_tracking(bool enabled, size_t capacity) {
+    std::lock_guard<std::mutex> lock(impl_->change_mutex);
+    impl_->change_capacity = capacity;
+    impl_->change_tracking.store(enabled, std::memory_order_relaxed);
+    if (!enabled) {
+        impl_->change_ring.clear();
     }
+}
+
+void Database::set_change_filter(std::vector<std::string> tables) {
+    std::lock_guard<std::mutex> lock(impl_->change_mutex);
+    impl_->change_filter = std::set<std::string>(tables.begin(), tables.end());
+}
+
+void Database::set_change_callback(std::function<void(const Change&)> callback) {
+    std::lock_guard<std::mutex> lock(impl_->change_mutex);
+    impl_->change_callback = std::move(callback);
+}
 
-    if (!valid) {
-        throw std::runtime_error("Type mismatch for column '" + column + "': expected " + col_type + " but got " +
-                                 actual_type);
-    }
+std::vector<Change> Database::poll_changes() {
+    std::lock_guard<std::mutex> lock(impl_->change_mutex);
+    std::vector<Change> changes(impl_->change_ring.begin(), impl_->change_ring.end());
+    impl_->change_ring.clear();
+    return changes;
 }
 
-int64_t Database::get_element_id(const std::string& collection, const std::string& label) const {
+void Database::prefetch_labels(const std::string& collection) {
     if (!is_open()) {
         throw std::runtime_error("Database is not open");
     }
 
-    auto result =
-        const_cast<Database*>(this)->execute("SELECT id FROM \"" + collection + "\" WHERE label = ?", {label});
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
 
-    if (result.empty()) {
-        throw std::runtime_error("Element not found: " + label + " in " + collection);
-    }
+    std::unordered_map<std::string, int64_t> labels;
 
-    auto id = result[0].get_int(0);
-    if (!id) {
-        throw std::runtime_error("Invalid ID for element: " + label);
+    auto cursor = query("SELECT id, label FROM \"" + collection + "\"");
+    while (cursor.step()) {
+        auto id = cursor.get_int(0);
+        auto label = cursor.get_text(1);
+        if (id && label) {
+            labels.emplace(std::string(*label), *id);
+        }
     }
-    return *id;
+
+    impl_->log()->debug("Prefetched {} labels for {}", labels.size(), collection);
+    impl_->label_cache[collection] = std::move(labels);
 }
 
 Value Database::resolve_relation(const std::string& table, const std::string& column, const Value& value) {
-    // Get foreign key info for this column
-    auto fks = get_foreign_keys(table);
-
-    for (const auto& fk : fks) {
-        if (fk.column == column) {
-            // This column is a foreign key
-            if (std::holds_alternative<std::string>(value)) {
-                // Resolve label to ID
-                const auto& label = std::get<std::string>(value);
-                return get_element_id(fk.target_table, label);
-            } else if (std::holds_alternative<std::vector<std::string>>(value)) {
-                // Resolve vector of labels to vector of IDs
-                const auto& labels = std::get<std::vector<std::string>>(value);
-                std::vector<int64_t> ids;
-                ids.reserve(labels.size());
-                for (const auto& label : labels) {
-                    if (label.empty()) {
-                        // Empty string means NULL - use a sentinel value
-                        ids.push_back(std::numeric_limits<int64_t>::min());
-                    } else {
-                        ids.push_back(get_element_id(fk.target_table, label));
-                    }
+    // Look the column up in the compiled plan (avoids copying the FK list
+    // for every field)
+    ensure_table_schema(table);
+    const auto& plans = impl_->schema_cache[table].validation_plan;
+
+    auto it = plans.find(column);
+    if (it != plans.end() && !it->second.fk_target.empty()) {
+        const auto& target = it->second.fk_target;
+
+        if (std::holds_alternative<std::string>(value)) {
+            // Resolve label to ID
+            return get_element_id(target, std::get<std::string>(value));
+        }
+        if (std::holds_alternative<std::vector<std::string>>(value)) {
+            // Resolve vector of labels to vector of IDs
+            const auto& labels = std::get<std::vector<std::string>>(value);
+            std::vector<int64_t> ids;
+            ids.reserve(labels.size());
+            for (const auto& label : labels) {
+                if (label.empty()) {
+                    // Empty string means NULL - use a sentinel value
+                    ids.push_back(std::numeric_limits<int64_t>::min());
+                } else {
+                    ids.push_back(get_element_id(target, label));
                 }
-                return ids;
             }
-            break;
+            return ids;
         }
     }
 
@@ -668,6 +1958,44 @@ Value Database::resolve_relation(const std::string& table, const std::string& co
     return value;
 }
 
+void Database::execute_batch(const std::string& sql, const std::vector<std::vector<Value>>& rows) {
+    if (rows.empty()) {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    // Only open a transaction if the caller has not already done so
+    bool own_transaction = sqlite3_get_autocommit(impl_->db) != 0;
+    if (own_transaction) {
+        execute("BEGIN TRANSACTION");
+    }
+
+    sqlite3_stmt* stmt = impl_->acquire_statement(sql).stmt;
+
+    try {
+        for (const auto& row : rows) {
+            bind_parameters(stmt, row);
+
+            int rc = sqlite3_step(stmt);
+            sqlite3_reset(stmt);
+            if (rc != SQLITE_DONE) {
+                throw std::runtime_error("Failed to execute statement: " + std::string(sqlite3_errmsg(impl_->db)));
+            }
+            sqlite3_clear_bindings(stmt);
+        }
+    } catch (const std::exception&) {
+        if (own_transaction) {
+            execute("ROLLBACK");
+        }
+        throw;
+    }
+
+    if (own_transaction) {
+        execute("COMMIT");
+    }
+}
+
 void Database::insert_vectors(const std::string& collection, int64_t element_id,
                               const std::vector<std::pair<std::string, Value>>& vector_fields) {
     if (vector_fields.empty()) {
@@ -737,49 +2065,53 @@ void Database::insert_vectors(const std::string& collection, int64_t element_id,
             resolved_fields.emplace_back(name, resolve_relation(table, name, value));
         }
 
-        // Get table columns to determine column order
-        auto columns = get_table_columns(table);
+        // Build the INSERT once; every row shares the same column list
+        std::string sql;
+        std::string placeholders;
+
+        if (is_set) {
+            // Set tables don't have vector_index
+            sql = "INSERT INTO \"" + table + "\" (id";
+            placeholders = "?";
+        } else {
+            // Vector tables have vector_index
+            sql = "INSERT INTO \"" + table + "\" (id, vector_index";
+            placeholders = "?, ?";
+        }
+
+        for (const auto& [name, value] : resolved_fields) {
+            sql += ", \"" + name + "\"";
+            placeholders += ", ?";
+        }
+        sql += ") VALUES (" + placeholders + ")";
+
+        // Collect one bound row per vector index
+        std::vector<std::vector<Value>> rows;
+        rows.reserve(vec_size);
 
-        // Insert one row per vector index
         for (size_t i = 0; i < vec_size; ++i) {
-            std::string sql;
-            std::string placeholders;
             std::vector<Value> values;
+            values.reserve(resolved_fields.size() + 2);
 
-            if (is_set) {
-                // Set tables don't have vector_index
-                sql = "INSERT INTO \"" + table + "\" (id";
-                placeholders = "?";
-                values.push_back(element_id);
-            } else {
-                // Vector tables have vector_index
-                sql = "INSERT INTO \"" + table + "\" (id, vector_index";
-                placeholders = "?, ?";
-                values.push_back(element_id);
+            values.push_back(element_id);
+            if (!is_set) {
                 values.push_back(static_cast<int64_t>(i + 1));  // 1-indexed
             }
 
             for (const auto& [name, value] : resolved_fields) {
-                sql += ", \"" + name + "\"";
-                placeholders += ", ?";
-
                 Value elem = get_vector_element(value, i);
                 // Handle sentinel value for NULL
-                if (std::holds_alternative<int64_t>(elem)) {
-                    int64_t v = std::get<int64_t>(elem);
-                    if (v == std::numeric_limits<int64_t>::min()) {
-                        values.push_back(nullptr);
-                    } else {
-                        values.push_back(elem);
-                    }
+                if (std::holds_alternative<int64_t>(elem) &&
+                    std::get<int64_t>(elem) == std::numeric_limits<int64_t>::min()) {
+                    values.push_back(nullptr);
                 } else {
-                    values.push_back(elem);
+                    values.push_back(std::move(elem));
                 }
             }
-
-            sql += ") VALUES (" + placeholders + ")";
-            execute(sql, values);
+            rows.push_back(std::move(values));
         }
+
+        execute_batch(sql, rows);
     }
 }
 
@@ -827,23 +2159,365 @@ void Database::insert_time_series(const std::string& collection, int64_t element
             }
         }
 
-        // Insert each row
+        // Build the INSERT once; every row shares the same column list
+        std::string sql = "INSERT INTO \"" + table + "\" (id";
+        std::string placeholders = "?";
+        for (const auto& [col, col_values] : data) {
+            sql += ", \"" + col + "\"";
+            placeholders += ", ?";
+        }
+        sql += ") VALUES (" + placeholders + ")";
+
+        // Collect one bound row per time series entry
+        std::vector<std::vector<Value>> rows;
+        rows.reserve(row_count);
+
         for (size_t i = 0; i < row_count; ++i) {
-            std::string sql = "INSERT INTO \"" + table + "\" (id";
-            std::string placeholders = "?";
             std::vector<Value> values;
+            values.reserve(data.size() + 1);
             values.push_back(element_id);
 
             for (const auto& [col, col_values] : data) {
-                sql += ", \"" + col + "\"";
-                placeholders += ", ?";
                 values.push_back(to_scalar_value(col_values[i]));
             }
+            rows.push_back(std::move(values));
+        }
+
+        execute_batch(sql, rows);
+    }
+}
+
+void Database::attach(const std::string& path, const std::string& alias) {
+    execute("ATTACH DATABASE ? AS \"" + alias + "\"", {Value{path}});
+    impl_->log()->debug("Attached {} as {}", path, alias);
+}
+
+void Database::detach(const std::string& alias) {
+    execute("DETACH DATABASE \"" + alias + "\"");
+}
+
+void Database::merge_from(const std::string& alias, const std::vector<std::string>& tables) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    // Tables present in the attached database
+    std::vector<std::string> candidates;
+    {
+        auto cursor = query("SELECT name FROM \"" + alias +
+                            "\".sqlite_master WHERE type='table' AND name NOT LIKE 'sqlite_%' ORDER BY name");
+        while (cursor.step()) {
+            std::string name(*cursor.get_text(0));
+            if (tables.empty() || std::find(tables.begin(), tables.end(), name) != tables.end()) {
+                candidates.push_back(name);
+            }
+        }
+    }
+
+    // Order parents before children using main's foreign key graph
+    // (Kahn's algorithm; any residue from cycles keeps its listed order)
+    std::map<std::string, std::set<std::string>> depends_on;
+    for (const auto& table : candidates) {
+        auto& deps = depends_on[table];
+        for (const auto& fk : get_foreign_keys(table)) {
+            if (fk.target_table != table &&
+                std::find(candidates.begin(), candidates.end(), fk.target_table) != candidates.end()) {
+                deps.insert(fk.target_table);
+            }
+        }
+    }
+
+    std::vector<std::string> ordered;
+    while (ordered.size() < candidates.size()) {
+        bool progressed = false;
+        for (const auto& table : candidates) {
+            if (std::find(ordered.begin(), ordered.end(), table) != ordered.end()) {
+                continue;
+            }
+            bool ready = true;
+            for (const auto& dep : depends_on[table]) {
+                if (std::find(ordered.begin(), ordered.end(), dep) == ordered.end()) {
+                    ready = false;
+                    break;
+                }
+            }
+            if (ready) {
+                ordered.push_back(table);
+                progressed = true;
+            }
+        }
+        if (!progressed) {
+            // FK cycle: append the rest in listed order
+            for (const auto& table : candidates) {
+                if (std::find(ordered.begin(), ordered.end(), table) == ordered.end()) {
+                    ordered.push_back(table);
+                }
+            }
+        }
+    }
+
+    impl_->log()->info("Merging {} tables from {}", ordered.size(), alias);
+
+    // One transaction around the whole merge
+    bool own_transaction = sqlite3_get_autocommit(impl_->db) != 0;
+    if (own_transaction) {
+        execute("BEGIN TRANSACTION");
+    }
+
+    try {
+        for (const auto& table : ordered) {
+            execute("INSERT INTO main.\"" + table + "\" SELECT * FROM \"" + alias + "\".\"" + table + "\"");
+        }
+    } catch (const std::exception&) {
+        if (own_transaction) {
+            execute("ROLLBACK");
+        }
+        throw;
+    }
+
+    if (own_transaction) {
+        execute("COMMIT");
+    }
+}
+
+namespace {
+
+// Shared backup loop: steps the copy, yielding between steps so the source
+// connection's readers and writers can make progress
+void run_backup(sqlite3* source, sqlite3* dest, int pages_per_step, int sleep_ms,
+                const std::function<void(int, int)>& progress) {
+    sqlite3_backup* backup = sqlite3_backup_init(dest, "main", source, "main");
+    if (!backup) {
+        throw std::runtime_error("Failed to start backup: " + std::string(sqlite3_errmsg(dest)));
+    }
+
+    int rc;
+    do {
+        rc = sqlite3_backup_step(backup, pages_per_step);
+        if (progress) {
+            progress(sqlite3_backup_remaining(backup), sqlite3_backup_pagecount(backup));
+        }
+        if (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED) {
+            sqlite3_sleep(sleep_ms);
+        }
+    } while (rc == SQLITE_OK || rc == SQLITE_BUSY || rc == SQLITE_LOCKED);
+
+    sqlite3_backup_finish(backup);
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Backup failed: " + std::string(sqlite3_errmsg(dest)));
+    }
+}
+
+}  // anonymous namespace
+
+void Database::backup_to(const std::string& path, int pages_per_step, int sleep_ms,
+                         const std::function<void(int remaining, int total)>& progress) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    sqlite3* dest = nullptr;
+    int rc = sqlite3_open(path.c_str(), &dest);
+    if (rc != SQLITE_OK) {
+        std::string error = sqlite3_errmsg(dest);
+        sqlite3_close(dest);
+        throw std::runtime_error("Failed to open backup target: " + error);
+    }
+
+    try {
+        run_backup(impl_->db, dest, pages_per_step, sleep_ms, progress);
+    } catch (const std::exception&) {
+        sqlite3_close(dest);
+        throw;
+    }
+    sqlite3_close(dest);
+
+    impl_->log()->info("Backup written to {}", path);
+}
+
+Database Database::snapshot(LogLevel console_level) const {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    Database clone(":memory:", console_level);
+    // A :memory: copy is fast; one big step keeps it atomic
+    run_backup(impl_->db, clone.impl_->db, -1, 0, {});
+    return clone;
+}
+
+BlobStream Database::open_blob(const std::string& table, const std::string& column, int64_t rowid, bool writable) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    sqlite3_blob* blob = nullptr;
+    int rc = sqlite3_blob_open(impl_->db, "main", table.c_str(), column.c_str(), rowid, writable ? 1 : 0, &blob);
+    if (rc != SQLITE_OK) {
+        throw std::runtime_error("Failed to open blob: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+
+    return BlobStream(impl_->db, blob);
+}
+
+std::vector<std::pair<int64_t, double>> Database::aggregate_vector(const std::string& collection,
+                                                                   const std::string& column, AggregateOp op,
+                                                                   bool group_by_element) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    // Locate the satellite table holding the column (vector or set tables,
+    // same resolution insert_vectors uses)
+    std::string table;
+    for (const auto& candidate : get_vector_tables(collection)) {
+        auto columns = get_table_columns(candidate);
+        if (std::find(columns.begin(), columns.end(), column) != columns.end()) {
+            table = candidate;
+            break;
+        }
+    }
+    if (table.empty()) {
+        for (const auto& candidate : get_set_tables(collection)) {
+            auto columns = get_table_columns(candidate);
+            if (std::find(columns.begin(), columns.end(), column) != columns.end()) {
+                table = candidate;
+                break;
+            }
+        }
+    }
+    if (table.empty()) {
+        throw std::runtime_error("Vector column not found in schema: " + column);
+    }
+
+    const char* function;
+    switch (op) {
+    case AggregateOp::sum:
+        function = "SUM";
+        break;
+    case AggregateOp::min:
+        function = "MIN";
+        break;
+    case AggregateOp::max:
+        function = "MAX";
+        break;
+    case AggregateOp::avg:
+        function = "AVG";
+        break;
+    case AggregateOp::count:
+    default:
+        function = "COUNT";
+        break;
+    }
+
+    std::string sql;
+    if (group_by_element) {
+        sql = std::string("SELECT id, ") + function + "(\"" + column + "\") FROM \"" + table +
+              "\" GROUP BY id ORDER BY id";
+    } else {
+        sql = std::string("SELECT 0, ") + function + "(\"" + column + "\") FROM \"" + table + "\"";
+    }
+
+    std::vector<std::pair<int64_t, double>> aggregates;
+    auto cursor = query(sql);
+    while (cursor.step()) {
+        aggregates.emplace_back(cursor.get_int(0).value_or(0), cursor.get_double(1).value_or(0.0));
+    }
+    return aggregates;
+}
+
+TimeSeries Database::read_time_series(const std::string& collection, const std::string& group, int64_t element_id) {
+    return read_time_series(collection, group, element_id, 0, std::numeric_limits<size_t>::max());
+}
 
-            sql += ") VALUES (" + placeholders + ")";
-            execute(sql, values);
+TimeSeries Database::read_time_series(const std::string& collection, const std::string& group, int64_t element_id,
+                                      size_t offset, size_t limit) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    std::string table = collection + "_time_series_" + group;
+
+    auto ts_tables = get_time_series_tables(collection);
+    if (std::find(ts_tables.begin(), ts_tables.end(), table) == ts_tables.end()) {
+        throw std::runtime_error("Time series group not found: " + group);
+    }
+
+    // Column order follows the table definition, skipping the element id
+    std::vector<std::string> columns;
+    for (const auto& col : get_table_columns(table)) {
+        if (col != "id") {
+            columns.push_back(col);
+        }
+    }
+
+    std::string sql = "SELECT ";
+    for (size_t i = 0; i < columns.size(); ++i) {
+        if (i > 0) {
+            sql += ", ";
+        }
+        sql += "\"" + columns[i] + "\"";
+    }
+    sql += " FROM \"" + table + "\" WHERE id = ? ORDER BY rowid LIMIT ? OFFSET ?";
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    sqlite3_stmt* stmt = impl_->acquire_statement(sql).stmt;
+    sqlite3_bind_int64(stmt, 1, element_id);
+    sqlite3_bind_int64(stmt, 2,
+                       limit > static_cast<size_t>(std::numeric_limits<int64_t>::max())
+                           ? -1  // no limit
+                           : static_cast<int64_t>(limit));
+    sqlite3_bind_int64(stmt, 3, static_cast<int64_t>(offset));
+
+    TimeSeries result;
+    std::vector<std::vector<Value>*> slots;
+    slots.reserve(columns.size());
+    for (const auto& col : columns) {
+        slots.push_back(&result[col]);
+    }
+
+    int rc;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        for (size_t i = 0; i < slots.size(); ++i) {
+            int idx = static_cast<int>(i);
+            switch (sqlite3_column_type(stmt, idx)) {
+            case SQLITE_INTEGER:
+                slots[i]->emplace_back(sqlite3_column_int64(stmt, idx));
+                break;
+            case SQLITE_FLOAT:
+                slots[i]->emplace_back(sqlite3_column_double(stmt, idx));
+                break;
+            case SQLITE_TEXT: {
+                const char* text = reinterpret_cast<const char*>(sqlite3_column_text(stmt, idx));
+                slots[i]->emplace_back(std::string(text ? text : ""));
+                break;
+            }
+            case SQLITE_BLOB: {
+                const uint8_t* data = reinterpret_cast<const uint8_t*>(sqlite3_column_blob(stmt, idx));
+                int size = sqlite3_column_bytes(stmt, idx);
+                slots[i]->emplace_back(std::vector<uint8_t>(data, data + size));
+                break;
+            }
+            case SQLITE_NULL:
+            default:
+                slots[i]->emplace_back(nullptr);
+                break;
+            }
         }
     }
+
+    sqlite3_reset(stmt);
+
+    if (rc != SQLITE_DONE) {
+        throw std::runtime_error("Failed to read time series: " + std::string(sqlite3_errmsg(impl_->db)));
+    }
+
+    return result;
 }
 
 int64_t Database::create_element(const std::string& table, const std::vector<std::pair<std::string, Value>>& fields) {
@@ -856,6 +2530,10 @@ int64_t Database::create_element(const std::string& table, const std::vector<std
         throw std::runtime_error("Database is not open");
     }
 
+    // Hold the connection for the whole element so last_insert_rowid and
+    // the satellite inserts cannot interleave with the async writer
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
     if (table.empty()) {
         throw std::runtime_error("Table name cannot be empty");
     }
@@ -898,7 +2576,7 @@ int64_t Database::create_element(const std::string& table, const std::vector<std
 
     sql += ") VALUES (" + placeholders + ")";
 
-    impl_->logger->debug("create_element SQL: {}", sql);
+    impl_->log()->debug("create_element SQL: {}", sql);
 
     // Extract values for binding
     std::vector<Value> values;
@@ -921,4 +2599,146 @@ int64_t Database::create_element(const std::string& table, const std::vector<std
     return element_id;
 }
 
+std::vector<int64_t> Database::create_elements(const std::string& table,
+                                               const std::vector<std::vector<std::pair<std::string, Value>>>& elements) {
+    return create_elements(table, elements, {});
+}
+
+std::vector<int64_t> Database::create_elements(const std::string& table,
+                                               const std::vector<std::vector<std::pair<std::string, Value>>>& elements,
+                                               const std::vector<std::map<std::string, TimeSeries>>& time_series) {
+    if (!is_open()) {
+        throw std::runtime_error("Database is not open");
+    }
+
+    if (!time_series.empty() && time_series.size() != elements.size()) {
+        throw std::runtime_error("time_series must have one entry per element");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(impl_->db_mutex);
+
+    std::vector<int64_t> ids;
+    ids.reserve(elements.size());
+
+    if (elements.empty()) {
+        return ids;
+    }
+
+    impl_->log()->debug("create_elements: {} elements into {}", elements.size(), table);
+
+    // Load every foreign key target's label map up front so per-element
+    // relation resolution is a hash lookup instead of a point query. The
+    // collection itself is skipped: inserting into it would drop its map
+    // again after every element.
+    auto prefetch_fk_targets = [this, &table](const std::string& source_table) {
+        for (const auto& fk : get_foreign_keys(source_table)) {
+            // Skip the collection itself (inserting into it would drop its
+            // map again after every element) and targets without labels
+            if (fk.target_table != table && !get_column_type(fk.target_table, "label").empty()) {
+                prefetch_labels(fk.target_table);
+            }
+        }
+    };
+
+    prefetch_fk_targets(table);
+    for (const auto& satellite : get_vector_tables(table)) {
+        prefetch_fk_targets(satellite);
+    }
+    for (const auto& satellite : get_set_tables(table)) {
+        prefetch_fk_targets(satellite);
+    }
+
+    // One transaction around the whole batch (unless the caller has one)
+    bool own_transaction = sqlite3_get_autocommit(impl_->db) != 0;
+    if (own_transaction) {
+        begin_transaction();
+    }
+
+    try {
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (time_series.empty()) {
+                ids.push_back(create_element(table, elements[i]));
+            } else {
+                ids.push_back(create_element(table, elements[i], time_series[i]));
+            }
+        }
+    } catch (const std::exception&) {
+        if (own_transaction) {
+            rollback();
+        }
+        throw;
+    }
+
+    if (own_transaction) {
+        commit();
+    }
+
+    return ids;
+}
+
+// Transaction guard (declared in transaction.h; lives here for access to
+// Database::Impl)
+
+Transaction::Transaction(Database& db) : Transaction(db, 0, 0) {}
+
+Transaction::Transaction(Database& db, uint64_t auto_commit_operations, uint64_t auto_commit_bytes)
+    : db_(db), depth_(db.impl_->transaction_depth), active_(true) {
+    if (depth_ == 0) {
+        db_.begin_transaction();
+        db_.impl_->gc_op_limit = auto_commit_operations;
+        db_.impl_->gc_byte_limit = auto_commit_bytes;
+        db_.impl_->gc_ops = 0;
+        db_.impl_->gc_bytes = 0;
+    } else {
+        // Nested guards are SAVEPOINTs; the bounded set of names keeps the
+        // statements in the prepared statement cache
+        savepoint_ = "psr_sp_" + std::to_string(depth_);
+        db_.execute("SAVEPOINT " + savepoint_);
+    }
+    ++db_.impl_->transaction_depth;
+}
+
+Transaction::~Transaction() {
+    if (active_) {
+        try {
+            rollback();
+        } catch (const std::exception& e) {
+            db_.impl_->log()->error("Transaction rollback failed: {}", e.what());
+        }
+    }
+}
+
+void Transaction::commit() {
+    if (!active_) {
+        throw std::runtime_error("Transaction is not active");
+    }
+
+    if (depth_ == 0) {
+        db_.impl_->gc_op_limit = 0;
+        db_.impl_->gc_byte_limit = 0;
+        db_.commit();
+    } else {
+        db_.execute("RELEASE " + savepoint_);
+    }
+    active_ = false;
+    --db_.impl_->transaction_depth;
+}
+
+void Transaction::rollback() {
+    if (!active_) {
+        throw std::runtime_error("Transaction is not active");
+    }
+
+    if (depth_ == 0) {
+        db_.impl_->gc_op_limit = 0;
+        db_.impl_->gc_byte_limit = 0;
+        db_.rollback();
+    } else {
+        db_.execute("ROLLBACK TO " + savepoint_);
+        db_.execute("RELEASE " + savepoint_);
+    }
+    active_ = false;
+    --db_.impl_->transaction_depth;
+}
+
 }  // namespace psr
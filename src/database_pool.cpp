@@ -0,0 +1,111 @@
+#include "psr/database_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+namespace psr {
+
+DatabasePool::DatabasePool(const std::string& path, size_t size, LogLevel console_level, Durability durability) {
+    if (size == 0) {
+        throw std::runtime_error("Pool size must be at least 1");
+    }
+
+    connections_.reserve(size);
+    available_.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        connections_.push_back(
+            std::make_unique<Database>(Database::open_read_only(path, console_level, durability)));
+        available_.push_back(connections_.back().get());
+    }
+}
+
+DatabasePool::~DatabasePool() = default;
+
+size_t DatabasePool::size() const {
+    return connections_.size();
+}
+
+DatabasePool::Lease DatabasePool::acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !available_.empty(); });
+
+    Database* db = available_.back();
+    available_.pop_back();
+    return Lease(this, db);
+}
+
+void DatabasePool::release(Database* db) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        available_.push_back(db);
+    }
+    cv_.notify_one();
+}
+
+DatabasePool::Lease::~Lease() {
+    if (pool_ && db_) {
+        pool_->release(db_);
+    }
+}
+
+DatabasePool::Lease::Lease(Lease&& other) noexcept : pool_(other.pool_), db_(other.db_) {
+    other.pool_ = nullptr;
+    other.db_ = nullptr;
+}
+
+DatabasePool::Lease& DatabasePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        if (pool_ && db_) {
+            pool_->release(db_);
+        }
+        pool_ = other.pool_;
+        db_ = other.db_;
+        other.pool_ = nullptr;
+        other.db_ = nullptr;
+    }
+    return *this;
+}
+
+std::vector<Result> DatabasePool::parallel_query(const std::vector<std::string>& queries) {
+    std::vector<Result> results(queries.size());
+    if (queries.empty()) {
+        return results;
+    }
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr first_error;
+    std::mutex error_mutex;
+
+    size_t worker_count = std::min(connections_.size(), queries.size());
+    std::vector<std::thread> workers;
+    workers.reserve(worker_count);
+
+    for (size_t w = 0; w < worker_count; ++w) {
+        workers.emplace_back([&] {
+            auto lease = acquire();
+            size_t i;
+            while ((i = next.fetch_add(1)) < queries.size()) {
+                try {
+                    results[i] = lease->execute(queries[i]);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!first_error) {
+                        first_error = std::current_exception();
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+    return results;
+}
+
+}  // namespace psr
@@ -7,66 +7,150 @@ namespace psr {
 Row::Row(std::vector<Value> values) : values_(std::move(values)) {}
 
 size_t Row::column_count() const {
-    return values_.size();
+    return cell_count();
 }
 
 const Value& Row::operator[](size_t index) const {
-    if (index >= values_.size()) {
+    if (index >= cell_count()) {
         throw std::out_of_range("Column index out of range");
     }
-    return values_[index];
+    return cell(index);
 }
 
 std::optional<int64_t> Row::get_int(size_t index) const {
-    if (index >= values_.size() || is_null(index)) {
+    if (index >= cell_count() || is_null(index)) {
         return std::nullopt;
     }
-    if (auto* val = std::get_if<int64_t>(&values_[index])) {
+    if (const auto* val = std::get_if<int64_t>(&cell(index))) {
         return *val;
     }
     return std::nullopt;
 }
 
 std::optional<double> Row::get_double(size_t index) const {
-    if (index >= values_.size() || is_null(index)) {
+    if (index >= cell_count() || is_null(index)) {
         return std::nullopt;
     }
-    if (auto* val = std::get_if<double>(&values_[index])) {
+    if (const auto* val = std::get_if<double>(&cell(index))) {
         return *val;
     }
     return std::nullopt;
 }
 
 std::optional<std::string> Row::get_string(size_t index) const {
-    if (index >= values_.size() || is_null(index)) {
+    if (index >= cell_count() || is_null(index)) {
         return std::nullopt;
     }
-    if (auto* val = std::get_if<std::string>(&values_[index])) {
+    if (const auto* val = std::get_if<std::string>(&cell(index))) {
         return *val;
     }
     return std::nullopt;
 }
 
 std::optional<std::vector<uint8_t>> Row::get_blob(size_t index) const {
-    if (index >= values_.size() || is_null(index)) {
+    if (index >= cell_count() || is_null(index)) {
         return std::nullopt;
     }
-    if (auto* val = std::get_if<std::vector<uint8_t>>(&values_[index])) {
+    if (const auto* val = std::get_if<std::vector<uint8_t>>(&cell(index))) {
         return *val;
     }
     return std::nullopt;
 }
 
+std::optional<std::string_view> Row::get_text_view(size_t index) const {
+    if (index >= cell_count() || is_null(index)) {
+        return std::nullopt;
+    }
+    if (const auto* val = std::get_if<std::string>(&cell(index))) {
+        return std::string_view(*val);
+    }
+    return std::nullopt;
+}
+
+std::optional<BlobView> Row::get_blob_view(size_t index) const {
+    if (index >= cell_count() || is_null(index)) {
+        return std::nullopt;
+    }
+    if (const auto* val = std::get_if<std::vector<uint8_t>>(&cell(index))) {
+        BlobView view;
+        view.data = val->data();
+        view.size = val->size();
+        return view;
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> Row::take_string(size_t index) {
+    if (index >= cell_count() || is_null(index)) {
+        return std::nullopt;
+    }
+    if (auto* val = std::get_if<std::string>(&cell(index))) {
+        return std::move(*val);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::vector<uint8_t>> Row::take_blob(size_t index) {
+    if (index >= cell_count() || is_null(index)) {
+        return std::nullopt;
+    }
+    if (auto* val = std::get_if<std::vector<uint8_t>>(&cell(index))) {
+        return std::move(*val);
+    }
+    return std::nullopt;
+}
+
 bool Row::is_null(size_t index) const {
-    if (index >= values_.size()) {
+    if (index >= cell_count()) {
         return true;
     }
-    return std::holds_alternative<std::nullptr_t>(values_[index]);
+    return std::holds_alternative<std::nullptr_t>(cell(index));
 }
 
 Result::Result(std::vector<std::string> columns, std::vector<Row> rows)
     : columns_(std::move(columns)), rows_(std::move(rows)) {}
 
+Result::Result(std::vector<std::string> columns, std::vector<Value> cells)
+    : columns_(std::move(columns)), cells_(std::move(cells)) {
+    rebuild_views();
+}
+
+Result::Result(const Result& other) : columns_(other.columns_), cells_(other.cells_) {
+    if (!cells_.empty()) {
+        rebuild_views();
+    } else {
+        rows_ = other.rows_;
+    }
+}
+
+Result& Result::operator=(const Result& other) {
+    if (this != &other) {
+        columns_ = other.columns_;
+        cells_ = other.cells_;
+        if (!cells_.empty()) {
+            rebuild_views();
+        } else {
+            rows_ = other.rows_;
+        }
+    }
+    return *this;
+}
+
+// Points one view row at each stride of the flat cell buffer
+void Result::rebuild_views() {
+    rows_.clear();
+    if (columns_.empty() || cells_.empty()) {
+        return;
+    }
+
+    size_t stride = columns_.size();
+    size_t row_count = cells_.size() / stride;
+    rows_.reserve(row_count);
+    for (size_t i = 0; i < row_count; ++i) {
+        rows_.push_back(Row(cells_.data() + i * stride, stride));
+    }
+}
+
 bool Result::empty() const {
     return rows_.empty();
 }
@@ -90,4 +174,11 @@ const Row& Result::operator[](size_t index) const {
     return rows_[index];
 }
 
+Row& Result::operator[](size_t index) {
+    if (index >= rows_.size()) {
+        throw std::out_of_range("Row index out of range");
+    }
+    return rows_[index];
+}
+
 }  // namespace psr
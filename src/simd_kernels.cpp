@@ -0,0 +1,182 @@
+#include "psr/simd_kernels.h"
+
+#include <algorithm>
+#include <bitset>
+
+// The AVX2 path relies on GCC/Clang function multiversioning
+// (__attribute__((target))); MSVC builds use the scalar fallback, which
+// its auto-vectorizer handles at the baseline ISA.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define PSR_KERNELS_X86 1
+#endif
+
+namespace psr {
+namespace kernels {
+
+namespace {
+
+// Scalar fallbacks. With the baseline ISA the compiler auto-vectorizes
+// these (SSE2 on x86-64, NEON on aarch64).
+
+double sum_scalar(const double* data, size_t count) {
+    double total = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+MinMax min_max_scalar(const double* data, size_t count) {
+    MinMax result;
+    if (count == 0) {
+        return result;
+    }
+    result.min = data[0];
+    result.max = data[0];
+    for (size_t i = 1; i < count; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+ptrdiff_t find_first_above_scalar(const double* data, size_t count, double threshold) {
+    for (size_t i = 0; i < count; ++i) {
+        if (data[i] > threshold) {
+            return static_cast<ptrdiff_t>(i);
+        }
+    }
+    return -1;
+}
+
+#ifdef PSR_KERNELS_X86
+
+__attribute__((target("avx2"))) double sum_avx2(const double* data, size_t count) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc = _mm256_add_pd(acc, _mm256_loadu_pd(data + i));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    double total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < count; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+__attribute__((target("avx2"))) MinMax min_max_avx2(const double* data, size_t count) {
+    if (count < 4) {
+        return min_max_scalar(data, count);
+    }
+
+    __m256d vmin = _mm256_loadu_pd(data);
+    __m256d vmax = vmin;
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m256d chunk = _mm256_loadu_pd(data + i);
+        vmin = _mm256_min_pd(vmin, chunk);
+        vmax = _mm256_max_pd(vmax, chunk);
+    }
+
+    alignas(32) double lo[4];
+    alignas(32) double hi[4];
+    _mm256_store_pd(lo, vmin);
+    _mm256_store_pd(hi, vmax);
+
+    MinMax result;
+    result.min = std::min(std::min(lo[0], lo[1]), std::min(lo[2], lo[3]));
+    result.max = std::max(std::max(hi[0], hi[1]), std::max(hi[2], hi[3]));
+    for (; i < count; ++i) {
+        result.min = std::min(result.min, data[i]);
+        result.max = std::max(result.max, data[i]);
+    }
+    return result;
+}
+
+__attribute__((target("avx2"))) ptrdiff_t find_first_above_avx2(const double* data, size_t count,
+                                                                double threshold) {
+    __m256d limit = _mm256_set1_pd(threshold);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d chunk = _mm256_loadu_pd(data + i);
+        int mask = _mm256_movemask_pd(_mm256_cmp_pd(chunk, limit, _CMP_GT_OQ));
+        if (mask != 0) {
+            return static_cast<ptrdiff_t>(i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask))));
+        }
+    }
+    for (; i < count; ++i) {
+        if (data[i] > threshold) {
+            return static_cast<ptrdiff_t>(i);
+        }
+    }
+    return -1;
+}
+
+bool avx2_available() {
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif  // PSR_KERNELS_X86
+
+// Runtime dispatch, resolved once
+struct Dispatch {
+    double (*sum)(const double*, size_t) = sum_scalar;
+    MinMax (*min_max)(const double*, size_t) = min_max_scalar;
+    ptrdiff_t (*find_first_above)(const double*, size_t, double) = find_first_above_scalar;
+    const char* name = "scalar";
+
+    Dispatch() {
+#ifdef PSR_KERNELS_X86
+        if (avx2_available()) {
+            sum = sum_avx2;
+            min_max = min_max_avx2;
+            find_first_above = find_first_above_avx2;
+            name = "avx2";
+        }
+#endif
+    }
+};
+
+const Dispatch& dispatch() {
+    static const Dispatch instance;
+    return instance;
+}
+
+}  // anonymous namespace
+
+double sum(const double* data, size_t count) {
+    return dispatch().sum(data, count);
+}
+
+MinMax min_max(const double* data, size_t count) {
+    return dispatch().min_max(data, count);
+}
+
+ptrdiff_t find_first_above(const double* data, size_t count, double threshold) {
+    return dispatch().find_first_above(data, count, threshold);
+}
+
+size_t popcount_bits(const uint8_t* bitmap, size_t bits) {
+    // std::bitset::count compiles everywhere (including MSVC, which lacks
+    // __builtin_popcount) and lowers to a popcnt instruction where available
+    size_t count = 0;
+    size_t full_bytes = bits / 8;
+    for (size_t i = 0; i < full_bytes; ++i) {
+        count += std::bitset<8>(bitmap[i]).count();
+    }
+    size_t tail = bits % 8;
+    if (tail) {
+        count += std::bitset<8>(bitmap[full_bytes] & ((1u << tail) - 1)).count();
+    }
+    return count;
+}
+
+const char* active_implementation() {
+    return dispatch().name;
+}
+
+}  // namespace kernels
+}  // namespace psr
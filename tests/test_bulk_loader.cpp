@@ -0,0 +1,98 @@
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <psr/bulk_loader.h>
+#include <string>
+
+namespace fs = std::filesystem;
+
+class BulkLoaderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path_ = (fs::temp_directory_path() / "psr_bulk_test.db").string();
+        if (fs::exists(test_db_path_)) {
+            fs::remove(test_db_path_);
+        }
+
+        psr::Database db(test_db_path_, psr::LogLevel::off);
+        db.execute("CREATE TABLE Plant (id INTEGER PRIMARY KEY AUTOINCREMENT, label TEXT UNIQUE NOT NULL)");
+        db.execute("CREATE TABLE Plant_vector_costs (id INTEGER REFERENCES Plant(id), "
+                   "vector_index INTEGER NOT NULL, cost REAL)");
+        db.execute("CREATE TABLE Plant_time_series_generation (id INTEGER REFERENCES Plant(id), "
+                   "date_time TEXT, generation REAL)");
+        for (int i = 0; i < 10; ++i) {
+            db.create_element("Plant", {{"label", std::string("P") + std::to_string(i)}});
+        }
+    }
+
+    void TearDown() override {
+        if (fs::exists(test_db_path_)) {
+            fs::remove(test_db_path_);
+        }
+    }
+
+    std::string test_db_path_;
+};
+
+TEST_F(BulkLoaderTest, LoadsTimeSeriesAndVectors) {
+    {
+        psr::BulkLoader loader(test_db_path_, 2, psr::LogLevel::off);
+
+        psr::TimeSeries series;
+        series["date_time"] = {std::string("h0"), std::string("h1"), std::string("h2")};
+        series["generation"] = {1.0, 2.0, 3.0};
+
+        for (int64_t id = 1; id <= 10; ++id) {
+            loader.enqueue_time_series("Plant", "generation", id, series);
+            loader.enqueue_vectors("Plant", id, {{"cost", std::vector<double>{0.5, 1.5}}});
+        }
+        loader.wait();
+    }
+
+    psr::Database db(test_db_path_, psr::LogLevel::off);
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM Plant_time_series_generation")[0].get_int(0), 30);
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM Plant_vector_costs")[0].get_int(0), 20);
+
+    auto row = db.execute("SELECT generation FROM Plant_time_series_generation WHERE id = 7 ORDER BY rowid");
+    ASSERT_EQ(row.row_count(), 3u);
+    EXPECT_DOUBLE_EQ(*row[1].get_double(0), 2.0);
+}
+
+TEST_F(BulkLoaderTest, ChunksOfOneTableApplyInOrder) {
+    {
+        psr::BulkLoader loader(test_db_path_, 4, psr::LogLevel::off);
+
+        for (int chunk = 0; chunk < 50; ++chunk) {
+            psr::TimeSeries series;
+            series["date_time"] = {std::string("c") + std::to_string(chunk)};
+            series["generation"] = {double(chunk)};
+            loader.enqueue_time_series("Plant", "generation", 1, series);
+        }
+        loader.wait();
+    }
+
+    psr::Database db(test_db_path_, psr::LogLevel::off);
+    auto rows = db.execute("SELECT generation FROM Plant_time_series_generation ORDER BY rowid");
+    ASSERT_EQ(rows.row_count(), 50u);
+    for (size_t i = 0; i < 50; ++i) {
+        EXPECT_DOUBLE_EQ(*rows[i].get_double(0), double(i));
+    }
+}
+
+TEST_F(BulkLoaderTest, WaitSurfacesErrors) {
+    psr::BulkLoader loader(test_db_path_, 2, psr::LogLevel::off);
+
+    psr::TimeSeries series;
+    series["date_time"] = {std::string("h0")};
+    series["generation"] = {1.0};
+    loader.enqueue_time_series("Plant", "nope", 1, series);  // unknown group
+
+    EXPECT_THROW(loader.wait(), std::runtime_error);
+
+    // The loader keeps working after an error
+    loader.enqueue_time_series("Plant", "generation", 1, series);
+    loader.wait();
+}
+
+TEST_F(BulkLoaderTest, ZeroWorkersRejected) {
+    EXPECT_THROW(psr::BulkLoader(test_db_path_, 0, psr::LogLevel::off), std::runtime_error);
+}
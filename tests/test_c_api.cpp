@@ -31,6 +31,44 @@ TEST_F(CApiTest, OpenAndClose) {
     psr_database_close(db);
 }
 
+TEST_F(CApiTest, OpenWithProfile) {
+    psr_error_t error;
+    psr_database_t* db =
+        psr_database_open_with_profile(test_db_path_.c_str(), PSR_LOG_OFF, PSR_DURABILITY_SAFE, &error);
+
+    ASSERT_NE(db, nullptr);
+    EXPECT_EQ(error, PSR_OK);
+
+    psr_result_t* result = psr_database_execute(db, "PRAGMA journal_mode", &error);
+    ASSERT_NE(result, nullptr);
+    EXPECT_STREQ(psr_result_get_string(result, 0, 0), "delete");
+
+    psr_result_free(result);
+    psr_database_close(db);
+}
+
+TEST_F(CApiTest, SubmitAndFlush) {
+    psr_error_t error;
+    psr_database_t* db = psr_database_open(":memory:", PSR_LOG_OFF, &error);
+    ASSERT_NE(db, nullptr);
+
+    psr_result_t* r = psr_database_execute(db, "CREATE TABLE t (v INTEGER)", &error);
+    psr_result_free(r);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(psr_database_submit(db, "INSERT INTO t (v) VALUES (1)"), PSR_OK);
+    }
+    EXPECT_EQ(psr_database_flush(db), PSR_OK);
+
+    psr_result_t* count = psr_database_execute(db, "SELECT COUNT(*) FROM t", &error);
+    int64_t n = 0;
+    psr_result_get_int(count, 0, 0, &n);
+    EXPECT_EQ(n, 100);
+    psr_result_free(count);
+
+    psr_database_close(db);
+}
+
 TEST_F(CApiTest, OpenInMemory) {
     psr_error_t error;
     psr_database_t* db = psr_database_open(":memory:", PSR_LOG_OFF, &error);
@@ -62,6 +100,69 @@ TEST_F(CApiTest, ExecuteQuery) {
     psr_database_close(db);
 }
 
+TEST_F(CApiTest, ZeroCopyRefsAndBulkColumns) {
+    psr_error_t error;
+    psr_database_t* db = psr_database_open(":memory:", PSR_LOG_OFF, &error);
+    ASSERT_NE(db, nullptr);
+
+    psr_result_free(psr_database_execute(db, "CREATE TABLE t (name TEXT, v REAL, n INTEGER)", &error));
+    psr_result_free(psr_database_execute(db, "INSERT INTO t VALUES ('ab', 1.5, 10)", &error));
+    psr_result_free(psr_database_execute(db, "INSERT INTO t VALUES (x'610062', 2.5, 20)", &error));  // "a\0b" blob
+    psr_result_free(psr_database_execute(db, "INSERT INTO t VALUES (NULL, NULL, 30)", &error));
+
+    psr_result_t* result = psr_database_execute(db, "SELECT name, v, n FROM t ORDER BY n", &error);
+    ASSERT_NE(result, nullptr);
+
+    size_t size = 0;
+    const char* text = psr_result_get_text_ref(result, 0, 0, &size);
+    ASSERT_NE(text, nullptr);
+    EXPECT_EQ(size, 2u);
+    EXPECT_EQ(std::string(text, size), "ab");
+    // Same backing storage as the copying accessor
+    EXPECT_EQ(text, psr_result_get_string(result, 0, 0));
+
+    const uint8_t* blob = psr_result_get_blob_ref(result, 1, 0, &size);
+    ASSERT_NE(blob, nullptr);
+    EXPECT_EQ(size, 3u);
+    EXPECT_EQ(blob[1], 0u);  // embedded NUL survives
+
+    EXPECT_EQ(psr_result_get_text_ref(result, 2, 0, &size), nullptr);  // null cell
+    EXPECT_EQ(size, 0u);
+
+    double doubles[8] = {0};
+    EXPECT_EQ(psr_result_copy_column_doubles(result, 1, doubles, 8), 3u);
+    EXPECT_DOUBLE_EQ(doubles[0], 1.5);
+    EXPECT_DOUBLE_EQ(doubles[1], 2.5);
+    EXPECT_DOUBLE_EQ(doubles[2], 0.0);  // null
+
+    int64_t ints[2] = {0};
+    EXPECT_EQ(psr_result_copy_column_ints(result, 2, ints, 2), 2u);  // capped at n
+    EXPECT_EQ(ints[0], 10);
+    EXPECT_EQ(ints[1], 20);
+
+    psr_result_free(result);
+    psr_database_close(db);
+}
+
+TEST_F(CApiTest, StatsSurface) {
+    psr_error_t error;
+    psr_database_t* db = psr_database_open(":memory:", PSR_LOG_OFF, &error);
+    ASSERT_NE(db, nullptr);
+
+    EXPECT_EQ(psr_database_set_stats_enabled(db, 1), PSR_OK);
+    psr_result_free(psr_database_execute(db, "CREATE TABLE t (v INTEGER)", &error));
+    psr_result_free(psr_database_execute(db, "INSERT INTO t (v) VALUES (1)", &error));
+
+    psr_database_stats_t stats;
+    EXPECT_EQ(psr_database_get_stats(db, &stats), PSR_OK);
+    EXPECT_GE(stats.prepare.count, 2u);
+    EXPECT_GE(stats.step.count, 2u);
+
+    EXPECT_EQ(psr_database_get_stats(db, nullptr), PSR_ERROR_INVALID_ARGUMENT);
+
+    psr_database_close(db);
+}
+
 TEST_F(CApiTest, InsertAndSelect) {
     psr_error_t error;
     psr_database_t* db = psr_database_open(":memory:", PSR_LOG_OFF, &error);
@@ -405,6 +506,119 @@ TEST_F(CApiElementTest, ElementSetMultipleFields) {
     psr_result_free(result);
 }
 
+TEST_F(CApiElementTest, CreateElementsBulk) {
+    psr_element_t* elems[3];
+    for (int i = 0; i < 3; ++i) {
+        elems[i] = psr_element_create();
+        std::string label = "Bulk " + std::to_string(i);
+        psr_element_set_string(elems[i], "label", label.c_str());
+    }
+
+    int64_t rowids[3] = {0, 0, 0};
+    EXPECT_EQ(psr_database_create_elements(db_, "Resource", elems, 3, rowids), PSR_OK);
+    EXPECT_EQ(rowids[0], 1);
+    EXPECT_EQ(rowids[1], 2);
+    EXPECT_EQ(rowids[2], 3);
+
+    for (auto* elem : elems) {
+        psr_element_free(elem);
+    }
+
+    psr_error_t error;
+    psr_result_t* result = psr_database_execute(db_, "SELECT COUNT(*) FROM Resource", &error);
+    int64_t count = 0;
+    psr_result_get_int(result, 0, 0, &count);
+    EXPECT_EQ(count, 3);
+    psr_result_free(result);
+}
+
+TEST_F(CApiElementTest, CreateElementsRollsBackOnFailure) {
+    psr_element_t* ok = psr_element_create();
+    psr_element_set_string(ok, "label", "Valid");
+    psr_element_t* bad = psr_element_create();
+    psr_element_set_string(bad, "label", "Invalid");
+    psr_element_set_string(bad, "type", "X");  // violates CHECK constraint
+
+    psr_element_t* elems[2] = {ok, bad};
+    int64_t rowids[2] = {0, 0};
+    EXPECT_EQ(psr_database_create_elements(db_, "Resource", elems, 2, rowids), PSR_ERROR_QUERY);
+
+    psr_element_free(ok);
+    psr_element_free(bad);
+
+    // Nothing committed
+    psr_error_t error;
+    psr_result_t* result = psr_database_execute(db_, "SELECT COUNT(*) FROM Resource", &error);
+    int64_t count = -1;
+    psr_result_get_int(result, 0, 0, &count);
+    EXPECT_EQ(count, 0);
+    psr_result_free(result);
+}
+
+TEST_F(CApiElementTest, ElementBatchBuilder) {
+    const char* columns[] = {"label", "value1"};
+    psr_element_batch_t* batch = psr_element_batch_create("Configuration", columns, 2);
+    ASSERT_NE(batch, nullptr);
+
+    for (int i = 0; i < 100; ++i) {
+        std::string label = "Batch " + std::to_string(i);
+        EXPECT_EQ(psr_batch_append_text(batch, 0, label.c_str()), PSR_OK);
+        EXPECT_EQ(psr_batch_append_double(batch, 1, i * 1.5), PSR_OK);
+        EXPECT_EQ(psr_batch_row_finish(batch), PSR_OK);
+    }
+    EXPECT_EQ(psr_element_batch_row_count(batch), 100u);
+
+    int64_t rowids[100];
+    EXPECT_EQ(psr_database_batch_flush(db_, batch, rowids), PSR_OK);
+    EXPECT_EQ(rowids[0], 1);
+    EXPECT_EQ(rowids[99], 100);
+
+    // The batch is reusable after a flush
+    EXPECT_EQ(psr_element_batch_row_count(batch), 0u);
+    psr_batch_append_text(batch, 0, "Chunk 2");
+    psr_batch_append_double(batch, 1, 7.0);
+    psr_batch_row_finish(batch);
+    EXPECT_EQ(psr_database_batch_flush(db_, batch, nullptr), PSR_OK);
+
+    psr_error_t error;
+    psr_result_t* result = psr_database_execute(db_, "SELECT COUNT(*), SUM(value1) FROM Configuration", &error);
+    int64_t count = 0;
+    psr_result_get_int(result, 0, 0, &count);
+    EXPECT_EQ(count, 101);
+    psr_result_free(result);
+
+    psr_element_batch_free(batch);
+}
+
+TEST_F(CApiElementTest, ElementBatchValidation) {
+    const char* columns[] = {"label"};
+    psr_element_batch_t* batch = psr_element_batch_create("Resource", columns, 1);
+    ASSERT_NE(batch, nullptr);
+
+    // Column index out of range
+    EXPECT_EQ(psr_batch_append_double(batch, 5, 1.0), PSR_ERROR_INVALID_ARGUMENT);
+
+    // Finishing an empty row is rejected
+    EXPECT_EQ(psr_batch_row_finish(batch), PSR_ERROR_INVALID_ARGUMENT);
+
+    // Unset columns are omitted: 'type' keeps its table default
+    psr_batch_append_text(batch, 0, "Defaulted");
+    psr_batch_row_finish(batch);
+    EXPECT_EQ(psr_database_batch_flush(db_, batch, nullptr), PSR_OK);
+
+    psr_error_t error;
+    psr_result_t* result = psr_database_execute(db_, "SELECT type FROM Resource WHERE label = 'Defaulted'", &error);
+    EXPECT_STREQ(psr_result_get_string(result, 0, 0), "D");
+    psr_result_free(result);
+
+    // Invalid create args
+    EXPECT_EQ(psr_element_batch_create(nullptr, columns, 1), nullptr);
+    EXPECT_EQ(psr_element_batch_create("Resource", nullptr, 1), nullptr);
+    EXPECT_EQ(psr_element_batch_create("Resource", columns, 0), nullptr);
+
+    psr_element_batch_free(batch);
+}
+
 TEST_F(CApiElementTest, ElementSetNull) {
     psr_element_t* elem = psr_element_create();
 
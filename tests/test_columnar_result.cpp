@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <psr/database.h>
+#include <psr/simd_kernels.h>
+#include <string>
+
+class ColumnarResultTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        db_ = std::make_unique<psr::Database>(":memory:");
+        db_->execute("CREATE TABLE readings (id INTEGER PRIMARY KEY, label TEXT, value REAL, payload BLOB)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('a', 1.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('b', 2.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES (NULL, NULL)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('d', 4.5)");
+    }
+
+    std::unique_ptr<psr::Database> db_;
+};
+
+TEST_F(ColumnarResultTest, TypedColumns) {
+    auto result = db_->execute_columnar("SELECT id, label, value FROM readings ORDER BY id");
+
+    ASSERT_EQ(result.row_count(), 4u);
+    ASSERT_EQ(result.column_count(), 3u);
+    EXPECT_EQ(result.columns()[1], "label");
+
+    EXPECT_EQ(result.column_type(0), psr::ColumnarResult::ColumnType::integer);
+    EXPECT_EQ(result.column_type(1), psr::ColumnarResult::ColumnType::text);
+    EXPECT_EQ(result.column_type(2), psr::ColumnarResult::ColumnType::real);
+
+    const auto& ids = result.int_column(0);
+    ASSERT_EQ(ids.size(), 4u);
+    EXPECT_EQ(ids[0], 1);
+    EXPECT_EQ(ids[3], 4);
+
+    const auto& values = result.double_column(2);
+    EXPECT_DOUBLE_EQ(values[0], 1.5);
+    EXPECT_DOUBLE_EQ(values[2], 0.0);  // null slot
+
+    EXPECT_EQ(result.text(1, 0), "a");
+    EXPECT_EQ(result.text(1, 3), "d");
+}
+
+TEST_F(ColumnarResultTest, NullBitmap) {
+    auto result = db_->execute_columnar("SELECT label, value FROM readings ORDER BY id");
+
+    EXPECT_FALSE(result.is_null(0, 0));
+    EXPECT_TRUE(result.is_null(0, 2));
+    EXPECT_TRUE(result.is_null(1, 2));
+    EXPECT_FALSE(result.is_null(1, 3));
+
+    // Null cells in a text column read as empty views
+    EXPECT_EQ(result.text(0, 2), "");
+}
+
+TEST_F(ColumnarResultTest, TypeDecidedByFirstNonNull) {
+    // First row is null; type comes from the second
+    auto result = db_->execute_columnar("SELECT value FROM readings ORDER BY (label IS NOT NULL), id");
+
+    EXPECT_EQ(result.column_type(0), psr::ColumnarResult::ColumnType::real);
+    EXPECT_TRUE(result.is_null(0, 0));
+    const auto& values = result.double_column(0);
+    EXPECT_DOUBLE_EQ(values[0], 0.0);
+    EXPECT_DOUBLE_EQ(values[1], 1.5);
+}
+
+TEST_F(ColumnarResultTest, BlobColumn) {
+    std::vector<uint8_t> payload = {0xAA, 0xBB};
+    db_->execute("INSERT INTO readings (label, payload) VALUES ('blob', ?)", {psr::Value{payload}});
+
+    auto result = db_->execute_columnar("SELECT payload FROM readings WHERE label = 'blob'");
+    ASSERT_EQ(result.row_count(), 1u);
+    EXPECT_EQ(result.column_type(0), psr::ColumnarResult::ColumnType::blob);
+
+    auto view = result.blob(0, 0);
+    ASSERT_EQ(view.size, 2u);
+    EXPECT_EQ(view.data[0], 0xAA);
+}
+
+TEST_F(ColumnarResultTest, WrongTypeThrows) {
+    auto result = db_->execute_columnar("SELECT id, label FROM readings");
+
+    EXPECT_THROW(result.double_column(0), std::runtime_error);
+    EXPECT_THROW(result.int_column(1), std::runtime_error);
+    EXPECT_THROW(result.text(0, 0), std::runtime_error);
+    EXPECT_THROW(result.int_column(99), std::out_of_range);
+}
+
+TEST_F(ColumnarResultTest, EmptyResult) {
+    auto result = db_->execute_columnar("SELECT id, label FROM readings WHERE id = -1");
+
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(result.row_count(), 0u);
+    EXPECT_EQ(result.column_count(), 2u);
+    EXPECT_EQ(result.column_type(0), psr::ColumnarResult::ColumnType::null);
+}
+
+TEST_F(ColumnarResultTest, Parameterized) {
+    auto result = db_->execute_columnar("SELECT value FROM readings WHERE value > ? ORDER BY id", {psr::Value{2.0}});
+
+    ASSERT_EQ(result.row_count(), 2u);
+    EXPECT_DOUBLE_EQ(result.double_column(0)[0], 2.5);
+    EXPECT_DOUBLE_EQ(result.double_column(0)[1], 4.5);
+}
+
+TEST_F(ColumnarResultTest, BulkScanKernels) {
+    db_->execute("DELETE FROM readings");
+    db_->begin_transaction();
+    for (int i = 1; i <= 1000; ++i) {
+        db_->execute("INSERT INTO readings (label, value) VALUES (?, ?)",
+                     {psr::Value{std::string("r")}, psr::Value{static_cast<double>(i)}});
+    }
+    db_->execute("INSERT INTO readings (label, value) VALUES ('null-row', NULL)");
+    db_->commit();
+
+    auto result = db_->execute_columnar("SELECT value FROM readings ORDER BY id");
+    ASSERT_EQ(result.row_count(), 1001u);
+
+    EXPECT_DOUBLE_EQ(result.column_sum(0), 1000.0 * 1001.0 / 2.0);  // null slot adds 0
+
+    auto [min, max] = result.column_min_max(0);
+    EXPECT_DOUBLE_EQ(min, 0.0);  // the null slot
+    EXPECT_DOUBLE_EQ(max, 1000.0);
+
+    EXPECT_EQ(result.find_first_above(0, 500.0), 500);   // value 501 at row 500
+    EXPECT_EQ(result.find_first_above(0, 2000.0), -1);
+
+    EXPECT_EQ(result.null_count(0), 1u);
+
+    // Wrong column type rejected like the other typed accessors
+    auto labels = db_->execute_columnar("SELECT label FROM readings");
+    EXPECT_THROW(labels.column_sum(0), std::runtime_error);
+
+    // The kernel layer reports which implementation dispatched
+    EXPECT_NE(psr::kernels::active_implementation(), nullptr);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <psr/database.h>
+#include <string>
+
+class CursorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        db_ = std::make_unique<psr::Database>(":memory:");
+        db_->execute("CREATE TABLE readings (id INTEGER PRIMARY KEY, label TEXT, value REAL, payload BLOB)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('a', 1.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('b', 2.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('c', 3.5)");
+    }
+
+    std::unique_ptr<psr::Database> db_;
+};
+
+TEST_F(CursorTest, StepThroughRows) {
+    auto cursor = db_->query("SELECT id, label, value FROM readings ORDER BY id");
+
+    EXPECT_EQ(cursor.column_count(), 3u);
+    EXPECT_EQ(cursor.columns()[1], "label");
+
+    ASSERT_TRUE(cursor.step());
+    EXPECT_EQ(cursor.get_int(0), 1);
+    EXPECT_EQ(cursor.get_text(1), "a");
+    EXPECT_EQ(cursor.get_double(2), 1.5);
+
+    ASSERT_TRUE(cursor.step());
+    EXPECT_EQ(cursor.get_text(1), "b");
+
+    ASSERT_TRUE(cursor.step());
+    EXPECT_EQ(cursor.get_text(1), "c");
+
+    EXPECT_FALSE(cursor.step());
+    EXPECT_TRUE(cursor.done());
+
+    // Further steps keep returning false
+    EXPECT_FALSE(cursor.step());
+}
+
+TEST_F(CursorTest, RangeForIteration) {
+    auto cursor = db_->query("SELECT value FROM readings ORDER BY id");
+
+    double sum = 0.0;
+    size_t count = 0;
+    for (const auto& row : cursor) {
+        sum += row.get_double(0).value_or(0.0);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 3u);
+    EXPECT_DOUBLE_EQ(sum, 7.5);
+}
+
+TEST_F(CursorTest, ParameterizedQuery) {
+    auto cursor = db_->query("SELECT label FROM readings WHERE value > ?", {psr::Value{2.0}});
+
+    ASSERT_TRUE(cursor.step());
+    EXPECT_EQ(cursor.get_text(0), "b");
+    ASSERT_TRUE(cursor.step());
+    EXPECT_EQ(cursor.get_text(0), "c");
+    EXPECT_FALSE(cursor.step());
+}
+
+TEST_F(CursorTest, NullAndTypeMismatch) {
+    db_->execute("INSERT INTO readings (label, value) VALUES (NULL, NULL)");
+
+    auto cursor = db_->query("SELECT label, value FROM readings WHERE label IS NULL");
+    ASSERT_TRUE(cursor.step());
+
+    EXPECT_TRUE(cursor.is_null(0));
+    EXPECT_EQ(cursor.get_text(0), std::nullopt);
+    EXPECT_EQ(cursor.get_int(1), std::nullopt);
+
+    // Out-of-range index
+    EXPECT_TRUE(cursor.is_null(99));
+    EXPECT_EQ(cursor.get_int(99), std::nullopt);
+}
+
+TEST_F(CursorTest, BlobView) {
+    std::vector<uint8_t> payload = {0x01, 0x02, 0x03};
+    db_->execute("INSERT INTO readings (label, payload) VALUES ('blob', ?)", {psr::Value{payload}});
+
+    auto cursor = db_->query("SELECT payload FROM readings WHERE label = 'blob'");
+    ASSERT_TRUE(cursor.step());
+
+    auto view = cursor.get_blob(0);
+    ASSERT_TRUE(view.has_value());
+    ASSERT_EQ(view->size, 3u);
+    EXPECT_EQ(view->data[0], 0x01);
+    EXPECT_EQ(view->data[2], 0x03);
+}
+
+TEST_F(CursorTest, EmptyResult) {
+    auto cursor = db_->query("SELECT * FROM readings WHERE id = -1");
+    EXPECT_FALSE(cursor.step());
+
+    // Range-for over an empty result does nothing
+    auto cursor2 = db_->query("SELECT * FROM readings WHERE id = -1");
+    size_t count = 0;
+    for (const auto& row : cursor2) {
+        (void)row;
+        ++count;
+    }
+    EXPECT_EQ(count, 0u);
+}
+
+TEST_F(CursorTest, InvalidSqlThrows) {
+    EXPECT_THROW(db_->query("NOT REAL SQL"), std::runtime_error);
+}
+
+TEST_F(CursorTest, MoveSemantics) {
+    auto cursor = db_->query("SELECT id FROM readings ORDER BY id");
+    ASSERT_TRUE(cursor.step());
+
+    auto moved = std::move(cursor);
+    EXPECT_EQ(moved.get_int(0), 1);
+    ASSERT_TRUE(moved.step());
+    EXPECT_EQ(moved.get_int(0), 2);
+}
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <gtest/gtest.h>
 #include <psr/database.h>
+#include <psr/transaction.h>
 #include <string>
 
 namespace fs = std::filesystem;
@@ -163,6 +164,519 @@ TEST_F(DatabaseTest, InvalidSqlThrows) {
     EXPECT_THROW(db.execute("INVALID SQL STATEMENT"), std::runtime_error);
 }
 
+TEST_F(DatabaseTest, StatementCacheHitsAndMisses) {
+    psr::Database db(":memory:");
+
+    db.execute("CREATE TABLE items (id INTEGER PRIMARY KEY, name TEXT)");
+
+    auto stats = db.statement_cache_stats();
+    EXPECT_EQ(stats.hits, 0u);
+
+    // Same SQL shape repeated: one miss, then hits
+    for (int i = 0; i < 10; ++i) {
+        db.execute("INSERT INTO items (name) VALUES (?)", {psr::Value{std::string("item")}});
+    }
+
+    stats = db.statement_cache_stats();
+    EXPECT_EQ(stats.hits, 9u);
+
+    auto result = db.execute("SELECT COUNT(*) FROM items");
+    EXPECT_EQ(result[0].get_int(0), 10);
+
+    // Clearing the cache forces the next execute to re-prepare
+    db.clear_statement_cache();
+    db.execute("INSERT INTO items (name) VALUES (?)", {psr::Value{std::string("item")}});
+    auto after_clear = db.statement_cache_stats();
+    EXPECT_EQ(after_clear.hits, stats.hits);
+    EXPECT_GT(after_clear.misses, stats.misses);
+}
+
+TEST_F(DatabaseTest, DurabilityProfiles) {
+    {
+        psr::Database db(test_db_path_, psr::LogLevel::info, psr::Durability::balanced);
+        auto mode = db.execute("PRAGMA journal_mode");
+        EXPECT_EQ(mode[0].get_string(0), "wal");
+        auto sync = db.execute("PRAGMA synchronous");
+        EXPECT_EQ(sync[0].get_int(0), 1);  // NORMAL
+    }
+    {
+        psr::Database db(test_db_path_, psr::LogLevel::info, psr::Durability::safe);
+        auto mode = db.execute("PRAGMA journal_mode");
+        EXPECT_EQ(mode[0].get_string(0), "delete");
+        auto sync = db.execute("PRAGMA synchronous");
+        EXPECT_EQ(sync[0].get_int(0), 2);  // FULL
+    }
+}
+
+TEST_F(DatabaseTest, SchemaCacheInvalidatedOnDdl) {
+    psr::Database db(":memory:");
+
+    db.execute("CREATE TABLE cfg (id INTEGER PRIMARY KEY, label TEXT)");
+    db.create_element("cfg", {{"label", psr::Value{std::string("a")}}});
+
+    // Adding a column must be visible to type validation on the next insert:
+    // a stale schema cache would skip validation and let the bad value through
+    db.execute("ALTER TABLE cfg ADD COLUMN extra INTEGER");
+    EXPECT_THROW(
+        db.create_element("cfg", {{"label", psr::Value{std::string("b")}}, {"extra", psr::Value{std::string("nope")}}}),
+        std::runtime_error);
+
+    db.create_element("cfg", {{"label", psr::Value{std::string("c")}}, {"extra", psr::Value{int64_t(5)}}});
+    auto result = db.execute("SELECT extra FROM cfg WHERE label = 'c'");
+    EXPECT_EQ(result[0].get_int(0), 5);
+}
+
+TEST_F(DatabaseTest, StatsDisabledByDefault) {
+    psr::Database db(":memory:");
+
+    db.execute("CREATE TABLE t (v INTEGER)");
+    db.execute("INSERT INTO t (v) VALUES (1)");
+
+    EXPECT_FALSE(db.stats_enabled());
+    auto stats = db.stats();
+    EXPECT_EQ(stats.prepare.count, 0u);
+    EXPECT_EQ(stats.step.count, 0u);
+}
+
+TEST_F(DatabaseTest, StatsRecordHotPaths) {
+    psr::Database db(":memory:");
+    db.set_stats_enabled(true);
+
+    db.execute("CREATE TABLE t (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.begin_transaction();
+    for (int i = 0; i < 10; ++i) {
+        db.execute("INSERT INTO t (v) VALUES (?)", {psr::Value{static_cast<int64_t>(i)}});
+    }
+    db.commit();
+    db.create_element("t", {{"v", psr::Value{int64_t(99)}}});
+
+    auto stats = db.stats();
+    EXPECT_GE(stats.prepare.count, 2u);       // CREATE + INSERT shapes
+    EXPECT_GE(stats.step.count, 12u);         // every execute steps
+    EXPECT_GE(stats.bind.count, stats.step.count - 1);
+    EXPECT_EQ(stats.commit.count, 1u);
+    EXPECT_GE(stats.introspection.count, 1u);  // create_element introspects t
+
+    // Histogram buckets sum to the operation count
+    uint64_t bucket_sum = 0;
+    for (uint64_t b : stats.step.histogram) {
+        bucket_sum += b;
+    }
+    EXPECT_EQ(bucket_sum, stats.step.count);
+    EXPECT_GE(stats.step.max_us, stats.step.total_us / std::max<uint64_t>(stats.step.count, 1));
+
+    db.reset_stats();
+    EXPECT_EQ(db.stats().step.count, 0u);
+}
+
+TEST_F(DatabaseTest, IndexAdvisorFlagsUnindexedFilters) {
+    psr::Database db(":memory:");
+    db.set_diagnostics_enabled(true);
+
+    db.execute("CREATE TABLE plant (id INTEGER PRIMARY KEY, label TEXT, capacity REAL)");
+    db.execute("CREATE INDEX idx_capacity ON plant (capacity)");
+    db.execute("INSERT INTO plant (label, capacity) VALUES ('a', 1.0)");
+
+    // label has no index: repeated lookups full-scan
+    for (int i = 0; i < 5; ++i) {
+        db.execute("SELECT id FROM plant WHERE label = ?", {psr::Value{std::string("a")}});
+    }
+    // capacity is indexed: no advice expected
+    db.execute("SELECT id FROM plant WHERE capacity > ?", {psr::Value{0.5}});
+
+    auto report = db.index_advisor_report();
+    ASSERT_EQ(report.size(), 1u);
+    EXPECT_EQ(report[0].table, "plant");
+    EXPECT_EQ(report[0].column, "label");
+    EXPECT_EQ(report[0].occurrences, 5u);
+
+    // Disabled mode records nothing new
+    db.set_diagnostics_enabled(false);
+    db.execute("SELECT id FROM plant WHERE label LIKE ?", {psr::Value{std::string("a%")}});
+    EXPECT_EQ(db.index_advisor_report().size(), 1u);
+}
+
+TEST_F(DatabaseTest, BlobStreamReadWrite) {
+    psr::Database db(":memory:");
+
+    db.execute("CREATE TABLE m (id INTEGER PRIMARY KEY, data BLOB)");
+    db.execute("INSERT INTO m (data) VALUES (zeroblob(?))", {psr::Value{int64_t(1024)}});
+    int64_t rowid = db.last_insert_rowid();
+
+    // Stream content in chunks
+    {
+        auto blob = db.open_blob("m", "data", rowid, true);
+        EXPECT_EQ(blob.size(), 1024u);
+
+        std::vector<uint8_t> chunk(256);
+        for (size_t c = 0; c < 4; ++c) {
+            std::fill(chunk.begin(), chunk.end(), static_cast<uint8_t>(c + 1));
+            blob.write(c * 256, chunk.data(), chunk.size());
+        }
+    }
+
+    // Read a slice back without touching the rest
+    auto blob = db.open_blob("m", "data", rowid);
+    std::vector<uint8_t> slice(16);
+    EXPECT_EQ(blob.read(300, slice.data(), slice.size()), 16u);
+    EXPECT_EQ(slice[0], 2);  // second chunk's fill value
+
+    // Reads clamp at the end; past-the-end reads return 0
+    std::vector<uint8_t> tail(64);
+    EXPECT_EQ(blob.read(1000, tail.data(), tail.size()), 24u);
+    EXPECT_EQ(blob.read(5000, tail.data(), tail.size()), 0u);
+
+    // Writes cannot grow the blob
+    EXPECT_THROW(db.open_blob("m", "data", rowid, true).write(1020, slice.data(), 16), std::runtime_error);
+}
+
+TEST_F(DatabaseTest, BlobStreamErrors) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE m (id INTEGER PRIMARY KEY, data BLOB)");
+    db.execute("INSERT INTO m (data) VALUES (x'0102')");
+    int64_t rowid = db.last_insert_rowid();
+
+    // Read-only stream rejects writes
+    auto ro = db.open_blob("m", "data", rowid);
+    uint8_t byte = 0xFF;
+    EXPECT_THROW(ro.write(0, &byte, 1), std::runtime_error);
+
+    // Missing row / table
+    EXPECT_THROW(db.open_blob("m", "data", 999), std::runtime_error);
+    EXPECT_THROW(db.open_blob("missing", "data", rowid), std::runtime_error);
+
+    // Closed stream
+    ro.close();
+    EXPECT_THROW(ro.read(0, &byte, 1), std::runtime_error);
+}
+
+TEST_F(DatabaseTest, TransactionGuardCommitsAndRollsBack) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (v INTEGER)");
+
+    {
+        psr::Transaction txn(db);
+        db.execute("INSERT INTO t (v) VALUES (1)");
+        txn.commit();
+    }
+    {
+        // Scope exit without commit rolls back
+        psr::Transaction txn(db);
+        db.execute("INSERT INTO t (v) VALUES (2)");
+    }
+
+    auto result = db.execute("SELECT COUNT(*) FROM t");
+    EXPECT_EQ(result[0].get_int(0), 1);
+}
+
+TEST_F(DatabaseTest, NestedTransactionsUseSavepoints) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (v INTEGER)");
+
+    psr::Transaction outer(db);
+    db.execute("INSERT INTO t (v) VALUES (1)");
+
+    {
+        psr::Transaction inner(db);
+        db.execute("INSERT INTO t (v) VALUES (2)");
+        inner.rollback();  // drops only the inner work
+    }
+    {
+        psr::Transaction inner(db);
+        db.execute("INSERT INTO t (v) VALUES (3)");
+        inner.commit();
+    }
+
+    outer.commit();
+
+    auto result = db.execute("SELECT v FROM t ORDER BY v");
+    ASSERT_EQ(result.row_count(), 2u);
+    EXPECT_EQ(result[0].get_int(0), 1);
+    EXPECT_EQ(result[1].get_int(0), 3);
+}
+
+TEST_F(DatabaseTest, GroupCommitBoundsCrashLoss) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (v INTEGER)");
+
+    {
+        // Auto-commit every 10 operations; the guard is abandoned
+        // (simulated crash), so only the uncommitted tail is lost
+        psr::Transaction txn(db, 10);
+        for (int i = 0; i < 25; ++i) {
+            db.execute("INSERT INTO t (v) VALUES (?)", {psr::Value{static_cast<int64_t>(i)}});
+        }
+    }
+
+    auto result = db.execute("SELECT COUNT(*) FROM t");
+    EXPECT_EQ(result[0].get_int(0), 20);  // two full groups survived
+}
+
+TEST_F(DatabaseTest, BackupToFile) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (v INTEGER)");
+    for (int i = 0; i < 100; ++i) {
+        db.execute("INSERT INTO t (v) VALUES (?)", {psr::Value{static_cast<int64_t>(i)}});
+    }
+
+    int callbacks = 0;
+    db.backup_to(test_db_path_, 16, 0, [&](int remaining, int total) {
+        ++callbacks;
+        EXPECT_LE(remaining, total);
+    });
+    EXPECT_GT(callbacks, 0);
+
+    psr::Database restored(test_db_path_);
+    EXPECT_EQ(restored.execute("SELECT COUNT(*), SUM(v) FROM t")[0].get_int(1), 99 * 100 / 2);
+}
+
+TEST_F(DatabaseTest, InMemorySnapshot) {
+    psr::Database db(test_db_path_);
+    db.execute("CREATE TABLE t (v INTEGER)");
+    db.execute("INSERT INTO t (v) VALUES (42)");
+
+    auto snap = db.snapshot();
+
+    // The snapshot is independent of the source
+    db.execute("INSERT INTO t (v) VALUES (43)");
+    EXPECT_EQ(snap.execute("SELECT COUNT(*) FROM t")[0].get_int(0), 1);
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM t")[0].get_int(0), 2);
+
+    snap.execute("INSERT INTO t (v) VALUES (99)");
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM t WHERE v = 99")[0].get_int(0), 0);
+}
+
+TEST_F(DatabaseTest, ChangeTrackingRecordsWrites) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.execute("CREATE TABLE other (id INTEGER PRIMARY KEY)");
+
+    db.set_change_tracking(true);
+    db.execute("INSERT INTO t (v) VALUES (1)");
+    db.execute("UPDATE t SET v = 2 WHERE id = 1");
+    db.execute("DELETE FROM t WHERE id = 1");
+
+    auto changes = db.poll_changes();
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].table, "t");
+    EXPECT_EQ(changes[0].op, psr::Change::Op::insert);
+    EXPECT_EQ(changes[0].rowid, 1);
+    EXPECT_EQ(changes[1].op, psr::Change::Op::update);
+    EXPECT_EQ(changes[2].op, psr::Change::Op::remove);
+
+    // Poll drains
+    EXPECT_TRUE(db.poll_changes().empty());
+
+    // Filter: only 'other' recorded
+    db.set_change_filter({"other"});
+    db.execute("INSERT INTO t (v) VALUES (3)");
+    db.execute("INSERT INTO other DEFAULT VALUES");
+    auto filtered = db.poll_changes();
+    ASSERT_EQ(filtered.size(), 1u);
+    EXPECT_EQ(filtered[0].table, "other");
+
+    // Callback fires inline
+    db.set_change_filter({});
+    int callback_count = 0;
+    db.set_change_callback([&](const psr::Change& change) {
+        ++callback_count;
+        EXPECT_EQ(change.table, "t");
+    });
+    db.execute("INSERT INTO t (v) VALUES (4)");
+    EXPECT_EQ(callback_count, 1);
+
+    // Ring bound: capacity 4, oldest dropped
+    db.set_change_callback(nullptr);
+    db.set_change_tracking(true, 4);
+    for (int i = 0; i < 10; ++i) {
+        db.execute("INSERT INTO t (v) VALUES (?)", {psr::Value{static_cast<int64_t>(i)}});
+    }
+    EXPECT_EQ(db.poll_changes().size(), 4u);
+}
+
+TEST_F(DatabaseTest, AttachAndMergeRespectsForeignKeyOrder) {
+    auto worker_path = (fs::temp_directory_path() / "psr_worker.db").string();
+    if (fs::exists(worker_path)) {
+        fs::remove(worker_path);
+    }
+
+    // Worker database: children reference parents
+    {
+        psr::Database worker(worker_path, psr::LogLevel::off);
+        worker.execute("CREATE TABLE plant (id INTEGER PRIMARY KEY, label TEXT)");
+        worker.execute("CREATE TABLE result (id INTEGER PRIMARY KEY, plant_id INTEGER REFERENCES plant(id), v REAL)");
+        worker.execute("INSERT INTO plant VALUES (1, 'P1'), (2, 'P2')");
+        worker.execute("INSERT INTO result VALUES (1, 1, 0.5), (2, 2, 1.5)");
+    }
+
+    psr::Database master(":memory:");
+    master.execute("CREATE TABLE plant (id INTEGER PRIMARY KEY, label TEXT)");
+    master.execute("CREATE TABLE result (id INTEGER PRIMARY KEY, plant_id INTEGER REFERENCES plant(id), v REAL)");
+
+    master.attach(worker_path, "w");
+    // 'result' sorts before 'plant' alphabetically; FK ordering must fix it
+    master.merge_from("w");
+    master.detach("w");
+
+    EXPECT_EQ(master.execute("SELECT COUNT(*) FROM plant")[0].get_int(0), 2);
+    EXPECT_EQ(master.execute("SELECT v FROM result WHERE plant_id = 2")[0].get_double(0), 1.5);
+
+    // Merge failures roll back as a unit: re-merging collides on ids
+    master.attach(worker_path, "w2");
+    EXPECT_THROW(master.merge_from("w2"), std::runtime_error);
+    EXPECT_EQ(master.execute("SELECT COUNT(*) FROM plant")[0].get_int(0), 2);
+
+    // Table filter
+    master.execute("DELETE FROM result");
+    master.execute("DELETE FROM plant");
+    master.merge_from("w2", {"plant"});
+    EXPECT_EQ(master.execute("SELECT COUNT(*) FROM plant")[0].get_int(0), 2);
+    EXPECT_EQ(master.execute("SELECT COUNT(*) FROM result")[0].get_int(0), 0);
+    master.detach("w2");
+
+    fs::remove(worker_path);
+}
+
+TEST_F(DatabaseTest, QueryCacheReadYourWrites) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.execute("CREATE TABLE other (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.execute("INSERT INTO t (v) VALUES (1)");
+    db.execute("INSERT INTO other (v) VALUES (10)");
+
+    db.set_query_cache(true);
+
+    // Repeat point query: one miss, then hits
+    for (int i = 0; i < 5; ++i) {
+        auto r = db.execute("SELECT v FROM t WHERE id = ?", {psr::Value{int64_t(1)}});
+        EXPECT_EQ(r[0].get_int(0), 1);
+    }
+    auto stats = db.stats();
+    EXPECT_EQ(stats.query_cache_hits, 4u);
+    EXPECT_EQ(stats.query_cache_misses, 1u);
+
+    // A write to t invalidates t's cached queries: reads observe the write
+    db.execute("UPDATE t SET v = 2 WHERE id = 1");
+    auto r = db.execute("SELECT v FROM t WHERE id = ?", {psr::Value{int64_t(1)}});
+    EXPECT_EQ(r[0].get_int(0), 2);
+    EXPECT_EQ(db.stats().query_cache_misses, 2u);
+
+    // ...but queries on unrelated tables stay cached
+    db.execute("SELECT v FROM other WHERE id = ?", {psr::Value{int64_t(1)}});
+    db.execute("UPDATE t SET v = 3");
+    db.execute("SELECT v FROM other WHERE id = ?", {psr::Value{int64_t(1)}});
+    EXPECT_EQ(db.stats().query_cache_hits, 5u);
+
+    // Different params are different entries
+    db.execute("SELECT v FROM t WHERE id = ?", {psr::Value{int64_t(999)}});
+    auto after = db.stats();
+    EXPECT_GT(after.query_cache_misses, 2u);
+
+    // Writes (non-readonly statements) are never cached
+    db.execute("INSERT INTO t (v) VALUES (7)");
+    db.execute("INSERT INTO t (v) VALUES (7)");
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM t WHERE v = 7")[0].get_int(0), 2);
+}
+
+TEST_F(DatabaseTest, QueryCacheBypassedInsideTransactions) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.execute("INSERT INTO t (v) VALUES (1)");
+    db.set_query_cache(true);
+
+    // Warm the cache, then read an uncommitted value inside a transaction
+    db.execute("SELECT v FROM t WHERE id = 1");
+    db.begin_transaction();
+    db.execute("UPDATE t SET v = 99 WHERE id = 1");
+    auto dirty = db.execute("SELECT v FROM t WHERE id = 1");
+    EXPECT_EQ(dirty[0].get_int(0), 99);  // in-transaction reads see the write
+    db.rollback();
+
+    // The rolled-back value must not have been cached
+    auto after = db.execute("SELECT v FROM t WHERE id = 1");
+    EXPECT_EQ(after[0].get_int(0), 1);
+}
+
+TEST_F(DatabaseTest, QueryCacheSurvivesDdlInvalidation) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (id INTEGER PRIMARY KEY, v INTEGER)");
+    db.execute("INSERT INTO t (v) VALUES (1)");
+    db.set_query_cache(true);
+
+    // Cache a read, then DDL on an unrelated table: the statement stays in
+    // the statement cache, and its read set must survive with it so later
+    // writes to t still invalidate
+    db.execute("SELECT v FROM t WHERE id = 1");
+    db.execute("CREATE TABLE unrelated (x INTEGER)");
+    db.execute("SELECT v FROM t WHERE id = 1");  // re-cached via cached stmt
+    db.execute("UPDATE t SET v = 2 WHERE id = 1");
+
+    auto result = db.execute("SELECT v FROM t WHERE id = 1");
+    EXPECT_EQ(result[0].get_int(0), 2);
+}
+
+TEST_F(DatabaseTest, SubmitRejectedInsideTransactions) {
+    psr::Database db(":memory:");
+    db.execute("CREATE TABLE t (v INTEGER)");
+
+    db.begin_transaction();
+    db.execute("INSERT INTO t (v) VALUES (1)");
+    // The writer defers to user transactions, so queueing here could block
+    // forever on backpressure; it must fail fast like flush() does
+    EXPECT_THROW(db.submit("INSERT INTO t (v) VALUES (2)"), std::runtime_error);
+    db.commit();
+
+    db.submit("INSERT INTO t (v) VALUES (3)");
+    db.flush();
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM t")[0].get_int(0), 2);
+}
+
+TEST_F(DatabaseTest, QueryCacheKeysAreCollisionFree) {
+    psr::Database db(":memory:");
+    db.set_query_cache(true);
+
+    // These parameter lists used to serialize to the same separator-joined
+    // key; the framed encoding must keep them distinct
+    auto first = db.execute("SELECT ?1, ?2", {psr::Value{std::string("a\x1f" "i0")}, psr::Value{nullptr}});
+    auto second = db.execute("SELECT ?1, ?2", {psr::Value{std::string("a")}, psr::Value{int64_t(0)}});
+
+    EXPECT_EQ(first[0].get_string(0), "a\x1f" "i0");
+    EXPECT_EQ(second[0].get_string(0), "a");
+    EXPECT_EQ(second[0].get_int(1), 0);
+}
+
+TEST_F(DatabaseTest, AsyncSubmitAndFlush) {
+    psr::Database db(test_db_path_);
+
+    db.execute("CREATE TABLE results (id INTEGER PRIMARY KEY, v REAL)");
+
+    for (int i = 0; i < 1000; ++i) {
+        db.submit("INSERT INTO results (v) VALUES (?)", {psr::Value{i * 0.5}});
+    }
+    db.flush();
+
+    auto result = db.execute("SELECT COUNT(*), SUM(v) FROM results");
+    EXPECT_EQ(result[0].get_int(0), 1000);
+    EXPECT_DOUBLE_EQ(result[0].get_double(1).value(), 0.5 * (999 * 1000 / 2));
+}
+
+TEST_F(DatabaseTest, AsyncWriterErrorSurfacesOnFlush) {
+    psr::Database db(":memory:");
+
+    db.execute("CREATE TABLE u (id INTEGER PRIMARY KEY)");
+    db.submit("INSERT INTO u (id) VALUES (1)");
+    db.flush();
+
+    db.submit("INSERT INTO u (id) VALUES (1)");  // UNIQUE violation in the writer
+    EXPECT_THROW(db.flush(), std::runtime_error);
+
+    // The pipeline keeps working after an error
+    db.submit("INSERT INTO u (id) VALUES (2)");
+    db.flush();
+    auto result = db.execute("SELECT COUNT(*) FROM u");
+    EXPECT_EQ(result[0].get_int(0), 2);
+}
+
 TEST_F(DatabaseTest, ResultIteration) {
     psr::Database db(":memory:");
 
@@ -319,6 +833,86 @@ TEST_F(MigrationTest, MigrateUpIncremental) {
     }
 }
 
+TEST_F(MigrationTest, MultiStatementMigration) {
+    create_migration(1, "CREATE TABLE a (id INTEGER PRIMARY KEY);\n"
+                        "CREATE TABLE b (id INTEGER PRIMARY KEY, a_id INTEGER REFERENCES a(id));\n"
+                        "CREATE INDEX idx_b_a ON b(a_id);");
+
+    auto db = psr::Database::from_schema(test_db_path_, test_schema_path_.string());
+    EXPECT_EQ(db.current_version(), 1);
+
+    // Every statement of the script must have been applied
+    auto result = db.execute("SELECT COUNT(*) FROM sqlite_master WHERE name IN ('a', 'b', 'idx_b_a')");
+    EXPECT_EQ(result[0].get_int(0), 3);
+}
+
+TEST_F(MigrationTest, PackedBundleMigration) {
+    create_migration(1, "CREATE TABLE users (id INTEGER PRIMARY KEY, name TEXT);");
+    create_migration(2, "CREATE TABLE posts (id INTEGER PRIMARY KEY, title TEXT);\n"
+                        "CREATE INDEX idx_posts_title ON posts(title);");
+
+    auto bundle_path = (fs::temp_directory_path() / "psr_test_schema.bundle").string();
+    psr::Database::pack_migrations(test_schema_path_.string(), bundle_path);
+
+    auto db = psr::Database::from_schema(test_db_path_, bundle_path);
+    EXPECT_EQ(db.current_version(), 2);
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM sqlite_master WHERE type='table' AND name IN ('users','posts')")[0]
+                  .get_int(0),
+              2);
+
+    // Reopening against the bundle is a no-op
+    db.close();
+    auto db2 = psr::Database::from_schema(test_db_path_, bundle_path);
+    EXPECT_EQ(db2.current_version(), 2);
+
+    fs::remove(bundle_path);
+}
+
+TEST_F(MigrationTest, BundleRollsBackAsAUnit) {
+    create_migration(1, "CREATE TABLE ok_table (id INTEGER);");
+    create_migration(2, "THIS IS INVALID SQL;");
+
+    auto bundle_path = (fs::temp_directory_path() / "psr_test_schema.bundle").string();
+    psr::Database::pack_migrations(test_schema_path_.string(), bundle_path);
+
+    EXPECT_THROW(psr::Database::from_schema(test_db_path_, bundle_path), std::runtime_error);
+
+    // Unlike directory migrations, the whole bundle rolls back together
+    psr::Database db(test_db_path_);
+    EXPECT_EQ(db.current_version(), 0);
+    EXPECT_EQ(db.execute("SELECT COUNT(*) FROM sqlite_master WHERE name='ok_table'")[0].get_int(0), 0);
+
+    fs::remove(bundle_path);
+}
+
+TEST_F(MigrationTest, FromTemplateClonesPremigratedDatabase) {
+    create_migration(1, "CREATE TABLE users (id INTEGER PRIMARY KEY, name TEXT);");
+
+    auto template_path = (fs::temp_directory_path() / "psr_template.db").string();
+    if (fs::exists(template_path)) {
+        fs::remove(template_path);
+    }
+    {
+        auto tmpl = psr::Database::from_schema(template_path, test_schema_path_.string());
+        tmpl.execute("INSERT INTO users (name) VALUES ('seed')");
+    }
+
+    auto db = psr::Database::from_template(test_db_path_, template_path);
+    EXPECT_EQ(db.current_version(), 1);
+    EXPECT_EQ(db.execute("SELECT name FROM users")[0].get_string(0), "seed");
+
+    // An existing, non-empty target is opened without cloning
+    db.execute("INSERT INTO users (name) VALUES ('local')");
+    db.close();
+    auto db2 = psr::Database::from_template(test_db_path_, template_path);
+    EXPECT_EQ(db2.execute("SELECT COUNT(*) FROM users")[0].get_int(0), 2);
+
+    EXPECT_THROW(psr::Database::from_template((fs::temp_directory_path() / "x.db").string(), "/nonexistent/t.db"),
+                 std::runtime_error);
+
+    fs::remove(template_path);
+}
+
 TEST_F(MigrationTest, SchemaPathMissing) {
     EXPECT_THROW(psr::Database::from_schema(test_db_path_, "/nonexistent/path"), std::runtime_error);
 }
@@ -680,6 +680,35 @@ TEST_F(CreateVectorsTest, ThrowsOnInvalidForeignKeyLabel) {
 // Time Series Tests
 // =============================================================================
 
+TEST_F(CreateVectorsTest, AggregateVectorPushdown) {
+    db().create_element("Configuration", {{"label", std::string("Toy Case")}});
+
+    db().create_element("Plant", {{"label", std::string("P1")}, {"capacity", 1.0},
+                                  {"some_factor", std::vector<double>{1.0, 2.0, 3.0}}});
+    db().create_element("Plant", {{"label", std::string("P2")}, {"capacity", 1.0},
+                                  {"some_factor", std::vector<double>{10.0, 20.0}}});
+
+    auto sums = db().aggregate_vector("Plant", "some_factor", psr::AggregateOp::sum);
+    ASSERT_EQ(sums.size(), 2u);
+    EXPECT_EQ(sums[0].first, 1);
+    EXPECT_DOUBLE_EQ(sums[0].second, 6.0);
+    EXPECT_EQ(sums[1].first, 2);
+    EXPECT_DOUBLE_EQ(sums[1].second, 30.0);
+
+    auto avgs = db().aggregate_vector("Plant", "some_factor", psr::AggregateOp::avg);
+    EXPECT_DOUBLE_EQ(avgs[1].second, 15.0);
+
+    auto counts = db().aggregate_vector("Plant", "some_factor", psr::AggregateOp::count);
+    EXPECT_DOUBLE_EQ(counts[0].second, 3.0);
+
+    // Whole-column aggregate
+    auto total = db().aggregate_vector("Plant", "some_factor", psr::AggregateOp::max, false);
+    ASSERT_EQ(total.size(), 1u);
+    EXPECT_DOUBLE_EQ(total[0].second, 20.0);
+
+    EXPECT_THROW(db().aggregate_vector("Plant", "no_such_column", psr::AggregateOp::sum), std::runtime_error);
+}
+
 class CreateTimeSeriesTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -726,6 +755,45 @@ TEST_F(CreateTimeSeriesTest, SucceedsWithBasicTimeSeries) {
     EXPECT_DOUBLE_EQ(ts_result[2].get_double(2).value_or(0.0), 120.0);
 }
 
+TEST_F(CreateTimeSeriesTest, ReadTimeSeriesRoundTrip) {
+    db().create_element("Configuration", {{"label", std::string("Toy Case")}});
+
+    psr::TimeSeries generation;
+    generation["date_time"] = {std::string("2020-01-01 00:00:00"), std::string("2020-01-01 01:00:00"),
+                               std::string("2020-01-01 02:00:00")};
+    generation["block"] = {int64_t(1), int64_t(2), int64_t(3)};
+    generation["generation"] = {100.0, 150.0, 120.0};
+
+    int64_t id = db().create_element("Plant", {{"label", std::string("Plant 1")}, {"capacity", 200.0}},
+                                     {{"generation", generation}});
+
+    auto read = db().read_time_series("Plant", "generation", id);
+    ASSERT_EQ(read.size(), 3u);  // date_time, block, generation
+    ASSERT_EQ(read["block"].size(), 3u);
+    EXPECT_EQ(std::get<int64_t>(read["block"][1]), 2);
+    EXPECT_EQ(std::get<std::string>(read["date_time"][0]), "2020-01-01 00:00:00");
+    EXPECT_DOUBLE_EQ(std::get<double>(read["generation"][2]), 120.0);
+
+    // Range read: one row starting at offset 1
+    auto range = db().read_time_series("Plant", "generation", id, 1, 1);
+    ASSERT_EQ(range["block"].size(), 1u);
+    EXPECT_EQ(std::get<int64_t>(range["block"][0]), 2);
+    EXPECT_DOUBLE_EQ(std::get<double>(range["generation"][0]), 150.0);
+}
+
+TEST_F(CreateTimeSeriesTest, ReadTimeSeriesErrors) {
+    db().create_element("Configuration", {{"label", std::string("Toy Case")}});
+    int64_t id = db().create_element("Plant", {{"label", std::string("Plant 1")}, {"capacity", 1.0}});
+
+    EXPECT_THROW(db().read_time_series("Plant", "nope", id), std::runtime_error);
+
+    // Unknown element: empty columns, not an error
+    auto empty = db().read_time_series("Plant", "generation", 999);
+    for (const auto& [col, values] : empty) {
+        EXPECT_TRUE(values.empty());
+    }
+}
+
 // Time series with multiple dimensions (date_time and segment)
 TEST_F(CreateTimeSeriesTest, SucceedsWithMultiDimensionalTimeSeries) {
     db().create_element("Configuration", {{"label", std::string("Toy Case")}});
@@ -875,3 +943,53 @@ TEST_F(GetElementIdTest, ThrowsOnNotFound) {
 TEST_F(GetElementIdTest, ThrowsOnInvalidTable) {
     EXPECT_THROW(db().get_element_id("NonexistentTable", "Label"), std::runtime_error);
 }
+
+TEST_F(GetElementIdTest, CreateElementsBulk) {
+    std::vector<std::vector<std::pair<std::string, psr::Value>>> elements;
+    for (int i = 0; i < 100; ++i) {
+        elements.push_back({{"label", std::string("Bulk ") + std::to_string(i)}});
+    }
+
+    auto ids = db().create_elements("Resource", elements);
+    ASSERT_EQ(ids.size(), 100u);
+    EXPECT_EQ(ids.front(), 1);
+    EXPECT_EQ(ids.back(), 100);
+
+    EXPECT_EQ(db().get_element_id("Resource", "Bulk 42"), 43);
+}
+
+TEST_F(GetElementIdTest, CreateElementsRollsBackOnFailure) {
+    std::vector<std::vector<std::pair<std::string, psr::Value>>> elements;
+    elements.push_back({{"label", std::string("Ok")}});
+    elements.push_back({{"label", std::string("Ok")}});  // violates UNIQUE
+
+    EXPECT_THROW(db().create_elements("Resource", elements), std::runtime_error);
+
+    auto result = db().execute("SELECT COUNT(*) FROM Resource");
+    EXPECT_EQ(result[0].get_int(0), 0);
+}
+
+TEST_F(GetElementIdTest, PrefetchedLabelsServeLookups) {
+    db().create_element("Resource", {{"label", std::string("Resource A")}});
+    db().create_element("Resource", {{"label", std::string("Resource B")}});
+
+    db().prefetch_labels("Resource");
+
+    EXPECT_EQ(db().get_element_id("Resource", "Resource A"), 1);
+    EXPECT_EQ(db().get_element_id("Resource", "Resource B"), 2);
+    EXPECT_THROW(db().get_element_id("Resource", "Nonexistent"), std::runtime_error);
+}
+
+TEST_F(GetElementIdTest, LabelCacheInvalidatedOnWrite) {
+    db().create_element("Resource", {{"label", std::string("Resource A")}});
+    db().prefetch_labels("Resource");
+
+    // A new element must be visible even though the map was prefetched
+    db().create_element("Resource", {{"label", std::string("Resource C")}});
+    EXPECT_EQ(db().get_element_id("Resource", "Resource C"), 2);
+
+    // Deletes must be visible too
+    db().prefetch_labels("Resource");
+    db().execute("DELETE FROM Resource WHERE label = 'Resource A'");
+    EXPECT_THROW(db().get_element_id("Resource", "Resource A"), std::runtime_error);
+}
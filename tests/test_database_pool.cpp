@@ -0,0 +1,89 @@
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <psr/database_pool.h>
+#include <string>
+
+namespace fs = std::filesystem;
+
+class DatabasePoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        test_db_path_ = (fs::temp_directory_path() / "psr_pool_test.db").string();
+        if (fs::exists(test_db_path_)) {
+            fs::remove(test_db_path_);
+        }
+
+        psr::Database db(test_db_path_, psr::LogLevel::off);
+        db.execute("CREATE TABLE numbers (n INTEGER)");
+        db.begin_transaction();
+        for (int i = 1; i <= 100; ++i) {
+            db.execute("INSERT INTO numbers (n) VALUES (?)", {psr::Value{static_cast<int64_t>(i)}});
+        }
+        db.commit();
+    }
+
+    void TearDown() override {
+        if (fs::exists(test_db_path_)) {
+            fs::remove(test_db_path_);
+        }
+    }
+
+    std::string test_db_path_;
+};
+
+TEST_F(DatabasePoolTest, AcquireAndQuery) {
+    psr::DatabasePool pool(test_db_path_, 2, psr::LogLevel::off);
+    EXPECT_EQ(pool.size(), 2u);
+
+    auto lease = pool.acquire();
+    auto result = lease->execute("SELECT COUNT(*) FROM numbers");
+    EXPECT_EQ(result[0].get_int(0), 100);
+}
+
+TEST_F(DatabasePoolTest, LeaseReturnsConnection) {
+    psr::DatabasePool pool(test_db_path_, 1, psr::LogLevel::off);
+
+    {
+        auto lease = pool.acquire();
+        lease->execute("SELECT 1");
+    }
+
+    // The single connection is available again
+    auto lease = pool.acquire();
+    auto result = lease->execute("SELECT MAX(n) FROM numbers");
+    EXPECT_EQ(result[0].get_int(0), 100);
+}
+
+TEST_F(DatabasePoolTest, ConnectionsAreReadOnly) {
+    psr::DatabasePool pool(test_db_path_, 1, psr::LogLevel::off);
+
+    auto lease = pool.acquire();
+    EXPECT_THROW(lease->execute("INSERT INTO numbers (n) VALUES (101)"), std::runtime_error);
+}
+
+TEST_F(DatabasePoolTest, ParallelQuery) {
+    psr::DatabasePool pool(test_db_path_, 4, psr::LogLevel::off);
+
+    std::vector<std::string> queries;
+    for (int i = 1; i <= 20; ++i) {
+        queries.push_back("SELECT SUM(n) FROM numbers WHERE n <= " + std::to_string(i * 5));
+    }
+
+    auto results = pool.parallel_query(queries);
+    ASSERT_EQ(results.size(), 20u);
+    for (int i = 1; i <= 20; ++i) {
+        int64_t limit = i * 5;
+        EXPECT_EQ(results[i - 1][0].get_int(0), limit * (limit + 1) / 2);
+    }
+}
+
+TEST_F(DatabasePoolTest, ParallelQueryPropagatesErrors) {
+    psr::DatabasePool pool(test_db_path_, 2, psr::LogLevel::off);
+
+    std::vector<std::string> queries = {"SELECT 1", "SELECT * FROM does_not_exist", "SELECT 2"};
+    EXPECT_THROW(pool.parallel_query(queries), std::runtime_error);
+}
+
+TEST_F(DatabasePoolTest, ZeroSizeRejected) {
+    EXPECT_THROW(psr::DatabasePool(test_db_path_, 0, psr::LogLevel::off), std::runtime_error);
+}
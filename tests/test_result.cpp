@@ -66,3 +66,56 @@ TEST(RowTest, BlobValue) {
     EXPECT_EQ((*result)[0], 0xDE);
     EXPECT_EQ((*result)[3], 0xEF);
 }
+
+TEST(RowTest, TextViewAndBlobView) {
+    std::vector<uint8_t> blob = {0x01, 0x02, 0x03};
+    std::vector<psr::Value> values = {std::string{"zero-copy"}, blob, nullptr, int64_t{7}};
+    psr::Row row(std::move(values));
+
+    auto text = row.get_text_view(0);
+    ASSERT_TRUE(text.has_value());
+    EXPECT_EQ(*text, "zero-copy");
+    // The view aliases the row's own buffer, no copy
+    EXPECT_EQ(text->data(), std::get<std::string>(row[0]).data());
+
+    auto view = row.get_blob_view(1);
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->size, 3u);
+    EXPECT_EQ(view->data, std::get<std::vector<uint8_t>>(row[1]).data());
+
+    EXPECT_FALSE(row.get_text_view(2).has_value());  // null
+    EXPECT_FALSE(row.get_text_view(3).has_value());  // wrong type
+    EXPECT_FALSE(row.get_text_view(99).has_value());
+}
+
+TEST(RowTest, TakeString) {
+    std::vector<psr::Value> values = {std::string{"movable"}, int64_t{1}};
+    psr::Row row(std::move(values));
+
+    auto taken = row.take_string(0);
+    ASSERT_TRUE(taken.has_value());
+    EXPECT_EQ(*taken, "movable");
+
+    // The cell's buffer has been transferred out
+    EXPECT_EQ(std::get<std::string>(row[0]), "");
+
+    EXPECT_FALSE(row.take_string(1).has_value());  // wrong type
+}
+
+TEST(ResultTest, ViewsOutliveAccess) {
+    std::vector<psr::Row> rows;
+    rows.emplace_back(std::vector<psr::Value>{std::string{"persistent"}});
+    psr::Result result({"name"}, std::move(rows));
+
+    auto view = result[0].get_text_view(0);
+    ASSERT_TRUE(view.has_value());
+
+    // Still valid after further reads of the same result
+    auto again = result[0].get_string(0);
+    EXPECT_EQ(*view, "persistent");
+    EXPECT_EQ(*again, "persistent");
+
+    // Move-out through the mutable accessor
+    auto taken = result[0].take_string(0);
+    EXPECT_EQ(*taken, "persistent");
+}
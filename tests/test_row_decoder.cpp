@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <psr/database.h>
+#include <psr/row_decoder.h>
+#include <string>
+
+namespace {
+
+struct Reading {
+    int64_t id = 0;
+    std::string label;
+    double value = 0.0;
+};
+
+}  // anonymous namespace
+
+template <>
+struct psr::row_binding<Reading> {
+    using columns = psr::columns<&Reading::id, &Reading::label, &Reading::value>;
+};
+
+class RowDecoderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        db_ = std::make_unique<psr::Database>(":memory:");
+        db_->execute("CREATE TABLE readings (id INTEGER PRIMARY KEY, label TEXT, value REAL)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('a', 1.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES ('b', 2.5)");
+        db_->execute("INSERT INTO readings (label, value) VALUES (NULL, NULL)");
+    }
+
+    std::unique_ptr<psr::Database> db_;
+};
+
+TEST_F(RowDecoderTest, DecodeResultIntoStructs) {
+    auto result = db_->execute("SELECT id, label, value FROM readings ORDER BY id");
+
+    std::vector<Reading> readings;
+    EXPECT_EQ(result.decode(readings), 3u);
+    ASSERT_EQ(readings.size(), 3u);
+
+    EXPECT_EQ(readings[0].id, 1);
+    EXPECT_EQ(readings[0].label, "a");
+    EXPECT_DOUBLE_EQ(readings[0].value, 1.5);
+    EXPECT_EQ(readings[1].label, "b");
+
+    // Null cells decode to defaults
+    EXPECT_EQ(readings[2].label, "");
+    EXPECT_DOUBLE_EQ(readings[2].value, 0.0);
+}
+
+TEST_F(RowDecoderTest, DecodeAppends) {
+    auto result = db_->execute("SELECT id, label, value FROM readings WHERE id = 1");
+
+    std::vector<Reading> readings(1);
+    result.decode(readings);
+    ASSERT_EQ(readings.size(), 2u);
+    EXPECT_EQ(readings[1].id, 1);
+}
+
+TEST_F(RowDecoderTest, CursorNextDecodesStreaming) {
+    auto cursor = db_->query("SELECT id, label, value FROM readings ORDER BY id");
+
+    Reading reading;
+    size_t count = 0;
+    double sum = 0.0;
+    while (cursor.next(reading)) {
+        ++count;
+        sum += reading.value;
+    }
+
+    EXPECT_EQ(count, 3u);
+    EXPECT_DOUBLE_EQ(sum, 4.0);
+    EXPECT_FALSE(cursor.next(reading));  // exhausted
+}